@@ -0,0 +1,102 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "data_stats.cpp"
+
+// Время выполнения body в миллисекундах (лучшее из repeats запусков)
+template<typename Body>
+double BestMilliseconds(size_t repeats, Body body) {
+    double best = 0.0;
+    for (size_t r = 0; r < repeats; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto finish = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(finish - start).count();
+        best = r == 0 || ms < best ? ms : best;
+    }
+    return best;
+}
+
+// Масштабирование параллельного вычисления: пул из threads - 1 потоков плюс
+// вызывающий поток, данные делятся на threads отрезков
+void BenchmarkScaling(const std::vector<int>& data) {
+    std::printf("%zu ints, hardware threads: %u\n", data.size(), std::thread::hardware_concurrency());
+    std::printf("%8s %10s %10s %10s\n", "threads", "ms", "GB/s", "speedup");
+
+    double single_ms = 0.0;
+    for (size_t threads = 1; threads <= 64; threads *= 2) {
+        ThreadPool pool(threads - 1);
+        DataStats stats;
+        double ms = BestMilliseconds(3, [&] {
+            stats = CalculateDataStatsParallel(data, pool, threads);
+        });
+        asm volatile("" : : "r"(&stats) : "memory");
+        if (threads == 1) {
+            single_ms = ms;
+        }
+        double gigabytes = static_cast<double>(data.size() * sizeof(int)) / 1e9;
+        std::printf("%8zu %10.2f %10.2f %10.2f\n", threads, ms, gigabytes / (ms / 1000.0), single_ms / ms);
+    }
+}
+
+// Потоковое вычисление против загрузки файла целиком: данные пишутся во
+// временный файл, затем считаются тремя способами. Для каждого печатается
+// время и объем памяти под данные
+void BenchmarkStreaming(const std::vector<int>& data) {
+    std::string path = (std::filesystem::temp_directory_path() /
+                        ("data_stats_benchmark." + std::to_string(std::random_device{}()) + ".bin")).string();
+    {
+        std::ofstream output(path, std::ios::binary | std::ios::trunc);
+        output.write(reinterpret_cast<const char*>(data.data()),
+                     static_cast<std::streamsize>(data.size() * sizeof(int)));
+    }
+    const double megabytes = static_cast<double>(data.size() * sizeof(int)) / (1 << 20);
+
+    std::printf("\n%.0f MB file\n", megabytes);
+    std::printf("%12s %10s %12s\n", "method", "ms", "buffer MB");
+
+    DataStats stats;
+    double load_ms = BestMilliseconds(3, [&] {
+        std::ifstream input(path, std::ios::binary);
+        std::vector<int> loaded(data.size());
+        input.read(reinterpret_cast<char*>(loaded.data()),
+                   static_cast<std::streamsize>(loaded.size() * sizeof(int)));
+        stats = CalculateDataStats(loaded);
+    });
+    std::printf("%12s %10.2f %12.2f\n", "load", load_ms, megabytes);
+
+    double stream_ms = BestMilliseconds(3, [&] {
+        std::ifstream input(path, std::ios::binary);
+        stats = CalculateDataStats(input);
+    });
+    std::printf("%12s %10.2f %12.2f\n", "istream", stream_ms,
+                static_cast<double>(kStreamChunk * sizeof(int)) / (1 << 20));
+
+    double mapped_ms = BestMilliseconds(3, [&] {
+        stats = CalculateDataStatsFromFile(path);
+    });
+    std::printf("%12s %10.2f %12.2f\n", "mmap", mapped_ms,
+                static_cast<double>(kMappedWindow) / (1 << 20));
+    asm volatile("" : : "r"(&stats) : "memory");
+
+    std::filesystem::remove(path);
+}
+
+// Аргумент - число элементов
+int main(int argc, char** argv) {
+    size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : size_t{1} << 24;
+
+    std::vector<int> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<int>((i * 7919) % 10007) - 5000;
+    }
+    BenchmarkScaling(data);
+    BenchmarkStreaming(data);
+    return 0;
+}
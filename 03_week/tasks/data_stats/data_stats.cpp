@@ -1,43 +1,673 @@
 #include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <istream>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#endif
+
 struct DataStats {
-    double avg = 0.0;  // среднее значение (average)
-    double sd = 0.0;   // стандартное отклонение (standard deviation)
+    double avg = 0.0;       // среднее значение (average)
+    double sd = 0.0;        // стандартное отклонение (standard deviation)
+    double min = 0.0;       // минимум
+    double max = 0.0;       // максимум
+    double skewness = 0.0;  // коэффициент асимметрии
+    double kurtosis = 0.0;  // коэффициент эксцесса (0 для нормального распределения)
 };
 
-// Вычисление среднего и суммы квадратов отклонений
-DataStats CalculateDataStats(const std::vector<int>& data) {
+// Накопитель центральных моментов до четвертого (алгоритм Уэлфорда в форме
+// Терриберри), минимума и максимума. Накопители, построенные по разным частям
+// данных, объединяются Merge (формулы Чана и Пебая), поэтому данные можно
+// обрабатывать параллельно
+class StatsAccumulator {
+private:
+    size_t count_ = 0;
+    double mean_ = 0.0;
+    double m2_ = 0.0;  // суммы степеней отклонений от среднего
+    double m3_ = 0.0;
+    double m4_ = 0.0;
+    double min_ = std::numeric_limits<double>::infinity();
+    double max_ = -std::numeric_limits<double>::infinity();
+
+public:
+    // Число независимых дорожек в AddRange
+    static constexpr size_t kLanes = 8;
+
+    void Add(double x);
+    void AddRange(const int* data, size_t size);
+    void Merge(const StatsAccumulator& other);
+
+    size_t Count() const;
+    double Mean() const;
+    DataStats Result() const;
+};
+
+// Добавление одного значения
+void StatsAccumulator::Add(double x) {
+    double n1 = static_cast<double>(count_);
+    ++count_;
+    double n = static_cast<double>(count_);
+    double delta = x - mean_;
+    double delta_n = delta / n;
+    double delta_n2 = delta_n * delta_n;
+    double term = delta * delta_n * n1;
+    mean_ += delta_n;
+    m4_ += term * delta_n2 * (n * n - 3.0 * n + 3.0) + 6.0 * delta_n2 * m2_ - 4.0 * delta_n * m3_;
+    m3_ += term * delta_n * (n - 2.0) - 3.0 * delta_n * m2_;
+    m2_ += term;
+    min_ = x < min_ ? x : min_;
+    max_ = x > max_ ? x : max_;
+}
+
+// Моменты kLanes независимых дорожек AddRange: элемент i блока попадает в
+// дорожку i. Счетчик у всех дорожек общий - число обработанных блоков
+struct LaneMoments {
+    double mean[StatsAccumulator::kLanes] = {};
+    double m2[StatsAccumulator::kLanes] = {};
+    double m3[StatsAccumulator::kLanes] = {};
+    double m4[StatsAccumulator::kLanes] = {};
+    double low[StatsAccumulator::kLanes];
+    double high[StatsAccumulator::kLanes];
+
+    LaneMoments();
+};
+
+LaneMoments::LaneMoments() {
+    for (size_t j = 0; j < StatsAccumulator::kLanes; ++j) {
+        low[j] = std::numeric_limits<double>::infinity();
+        high[j] = -std::numeric_limits<double>::infinity();
+    }
+}
+
+// Скалярное ядро: обновление Уэлфорда для blocks блоков по kLanes элементов.
+// Цикл по дорожкам не имеет зависимостей, компилятор может его векторизовать
+void AddLanesScalar(const int* data, size_t blocks, LaneMoments& lanes) {
+    constexpr size_t kLanes = StatsAccumulator::kLanes;
+    for (size_t b = 0; b < blocks; ++b) {
+        const int* block = data + b * kLanes;
+        double n1 = static_cast<double>(b);
+        double n = n1 + 1.0;
+        double inv_n = 1.0 / n;
+        double coef4 = n * n - 3.0 * n + 3.0;
+        for (size_t j = 0; j < kLanes; ++j) {
+            double x = static_cast<double>(block[j]);
+            double delta = x - lanes.mean[j];
+            double delta_n = delta * inv_n;
+            double delta_n2 = delta_n * delta_n;
+            double term = delta * delta_n * n1;
+            lanes.mean[j] += delta_n;
+            lanes.m4[j] += term * delta_n2 * coef4 + 6.0 * delta_n2 * lanes.m2[j] - 4.0 * delta_n * lanes.m3[j];
+            lanes.m3[j] += term * delta_n * (n - 2.0) - 3.0 * delta_n * lanes.m2[j];
+            lanes.m2[j] += term;
+            lanes.low[j] = x < lanes.low[j] ? x : lanes.low[j];
+            lanes.high[j] = x > lanes.high[j] ? x : lanes.high[j];
+        }
+    }
+}
+
+#if defined(__x86_64__) && defined(__GNUC__)
+// Проверка поддержки AVX2 процессором выполняется один раз
+bool CpuHasAvx2() {
+    static const bool has_avx2 = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return has_avx2;
+}
+
+// Ядро AVX2: 8 дорожек - два регистра по 4 double на каждый момент. Блок из
+// 8 int загружается одной командой и расширяется до double. Операции те же
+// и в том же порядке, что у скалярного ядра (без FMA), поэтому результат
+// совпадает с ним
+__attribute__((target("avx2")))
+void AddLanesAvx2(const int* data, size_t blocks, LaneMoments& lanes) {
+    __m256d mean[2], m2[2], m3[2], m4[2], low[2], high[2];
+    for (size_t h = 0; h < 2; ++h) {
+        mean[h] = _mm256_loadu_pd(lanes.mean + 4 * h);
+        m2[h] = _mm256_loadu_pd(lanes.m2 + 4 * h);
+        m3[h] = _mm256_loadu_pd(lanes.m3 + 4 * h);
+        m4[h] = _mm256_loadu_pd(lanes.m4 + 4 * h);
+        low[h] = _mm256_loadu_pd(lanes.low + 4 * h);
+        high[h] = _mm256_loadu_pd(lanes.high + 4 * h);
+    }
+    const __m256d three = _mm256_set1_pd(3.0);
+    const __m256d four = _mm256_set1_pd(4.0);
+    const __m256d six = _mm256_set1_pd(6.0);
+
+    for (size_t b = 0; b < blocks; ++b) {
+        double n1 = static_cast<double>(b);
+        double n = n1 + 1.0;
+        const __m256d n1v = _mm256_set1_pd(n1);
+        const __m256d inv_n = _mm256_set1_pd(1.0 / n);
+        const __m256d coef4 = _mm256_set1_pd(n * n - 3.0 * n + 3.0);
+        const __m256d coef3 = _mm256_set1_pd(n - 2.0);
+
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + b * StatsAccumulator::kLanes));
+        const __m256d values[2] = {_mm256_cvtepi32_pd(_mm256_castsi256_si128(block)),
+                                   _mm256_cvtepi32_pd(_mm256_extracti128_si256(block, 1))};
+        for (size_t h = 0; h < 2; ++h) {
+            const __m256d x = values[h];
+            const __m256d delta = _mm256_sub_pd(x, mean[h]);
+            const __m256d delta_n = _mm256_mul_pd(delta, inv_n);
+            const __m256d delta_n2 = _mm256_mul_pd(delta_n, delta_n);
+            const __m256d term = _mm256_mul_pd(_mm256_mul_pd(delta, delta_n), n1v);
+            mean[h] = _mm256_add_pd(mean[h], delta_n);
+            m4[h] = _mm256_add_pd(m4[h], _mm256_sub_pd(
+                _mm256_add_pd(_mm256_mul_pd(_mm256_mul_pd(term, delta_n2), coef4),
+                              _mm256_mul_pd(_mm256_mul_pd(six, delta_n2), m2[h])),
+                _mm256_mul_pd(_mm256_mul_pd(four, delta_n), m3[h])));
+            m3[h] = _mm256_add_pd(m3[h], _mm256_sub_pd(
+                _mm256_mul_pd(_mm256_mul_pd(term, delta_n), coef3),
+                _mm256_mul_pd(_mm256_mul_pd(three, delta_n), m2[h])));
+            m2[h] = _mm256_add_pd(m2[h], term);
+            low[h] = _mm256_min_pd(x, low[h]);
+            high[h] = _mm256_max_pd(x, high[h]);
+        }
+    }
+
+    for (size_t h = 0; h < 2; ++h) {
+        _mm256_storeu_pd(lanes.mean + 4 * h, mean[h]);
+        _mm256_storeu_pd(lanes.m2 + 4 * h, m2[h]);
+        _mm256_storeu_pd(lanes.m3 + 4 * h, m3[h]);
+        _mm256_storeu_pd(lanes.m4 + 4 * h, m4[h]);
+        _mm256_storeu_pd(lanes.low + 4 * h, low[h]);
+        _mm256_storeu_pd(lanes.high + 4 * h, high[h]);
+    }
+}
+#endif
+
+// Обработка блоков: векторное ядро, если процессор его поддерживает
+void AddLanes(const int* data, size_t blocks, LaneMoments& lanes) {
+#if defined(__x86_64__) && defined(__GNUC__)
+    if (CpuHasAvx2()) {
+        AddLanesAvx2(data, blocks, lanes);
+        return;
+    }
+#endif
+    AddLanesScalar(data, blocks, lanes);
+}
+
+// Добавление отрезка данных. Обновление Уэлфорда зависит от среднего на
+// предыдущем шаге и поэтому не векторизуется. Здесь данные раскладываются
+// по kLanes дорожкам с отдельными накопителями и общим счетчиком; дорожки
+// обновляются векторным ядром. В конце дорожки объединяются
+void StatsAccumulator::AddRange(const int* data, size_t size) {
+    size_t blocks = size / kLanes;
+    if (blocks < 2) {
+        for (size_t i = 0; i < size; ++i) {
+            Add(static_cast<double>(data[i]));
+        }
+        return;
+    }
+
+    LaneMoments lanes;
+    AddLanes(data, blocks, lanes);
+
+    for (size_t j = 0; j < kLanes; ++j) {
+        StatsAccumulator lane;
+        lane.count_ = blocks;
+        lane.mean_ = lanes.mean[j];
+        lane.m2_ = lanes.m2[j];
+        lane.m3_ = lanes.m3[j];
+        lane.m4_ = lanes.m4[j];
+        lane.min_ = lanes.low[j];
+        lane.max_ = lanes.high[j];
+        Merge(lane);
+    }
+    for (size_t i = blocks * kLanes; i < size; ++i) {
+        Add(static_cast<double>(data[i]));
+    }
+}
+
+// Объединение с накопителем по другой части данных
+void StatsAccumulator::Merge(const StatsAccumulator& other) {
+    if (other.count_ == 0) {
+        return;
+    }
+    if (count_ == 0) {
+        *this = other;
+        return;
+    }
+    double na = static_cast<double>(count_);
+    double nb = static_cast<double>(other.count_);
+    double n = na + nb;
+    double delta = other.mean_ - mean_;
+    double delta2 = delta * delta;
+    double delta3 = delta2 * delta;
+    double delta4 = delta2 * delta2;
+
+    double m4 = m4_ + other.m4_
+        + delta4 * na * nb * (na * na - na * nb + nb * nb) / (n * n * n)
+        + 6.0 * delta2 * (na * na * other.m2_ + nb * nb * m2_) / (n * n)
+        + 4.0 * delta * (na * other.m3_ - nb * m3_) / n;
+    double m3 = m3_ + other.m3_
+        + delta3 * na * nb * (na - nb) / (n * n)
+        + 3.0 * delta * (na * other.m2_ - nb * m2_) / n;
+    double m2 = m2_ + other.m2_ + delta2 * na * nb / n;
+
+    mean_ = mean_ + delta * nb / n;
+    m2_ = m2;
+    m3_ = m3;
+    m4_ = m4;
+    min_ = other.min_ < min_ ? other.min_ : min_;
+    max_ = other.max_ > max_ ? other.max_ : max_;
+    count_ += other.count_;
+}
+
+size_t StatsAccumulator::Count() const {
+    return count_;
+}
+
+double StatsAccumulator::Mean() const {
+    return mean_;
+}
+
+// Статистики по генеральной совокупности. Для постоянных данных
+// асимметрия и эксцесс равны 0
+DataStats StatsAccumulator::Result() const {
     DataStats result;
-    size_t n = data.size();  // размер вектора
-    
-    if (n == 0) {
+    if (count_ == 0) {
         return result;
     }
+    double n = static_cast<double>(count_);
+    result.avg = mean_;
+    result.sd = count_ > 1 ? std::sqrt(m2_ / n) : 0.0;
+    result.min = min_;
+    result.max = max_;
+    if (m2_ > 0.0) {
+        result.skewness = std::sqrt(n) * m3_ / std::pow(m2_, 1.5);
+        result.kurtosis = n * m4_ / (m2_ * m2_) - 3.0;
+    }
+    return result;
+}
 
-    double mean = 0.0;
-    double s = 0.0;  // сумма для дисперсии
-
-    // Алгоритм Уэлфорда
-    
-    for (size_t i = 0; i < n; ++i) {
-        double x = static_cast<double>(data[i]);
-        
-        // Обновление среднего
-        double old_mean = mean;
-        mean = old_mean + (x - old_mean) / (i + 1);
-        
-        // Обновление суммы квадратов отклонений
-        s = s + (x - old_mean) * (x - mean);
-    }
-    
-    result.avg = mean;
-    
-    if (n > 1) {
-        result.sd = std::sqrt(s / n);
+// Вычисление статистик за один проход
+DataStats CalculateDataStats(const std::vector<int>& data) {
+    StatsAccumulator accumulator;
+    accumulator.AddRange(data.data(), data.size());
+    return accumulator.Result();
+}
+
+// Потоковая оценка квантиля алгоритмом P² (Джейн и Хламтак): пять маркеров
+// с высотами q и позициями n, постоянная память. Пока значений меньше пяти,
+// квантиль считается точно
+class P2Quantile {
+private:
+    double p_;
+    size_t count_ = 0;
+    double heights_[5] = {};
+    double positions_[5] = {1.0, 2.0, 3.0, 4.0, 5.0};
+    double desired_[5];
+    double increments_[5];
+
+    double Parabolic(int i, double sign) const;
+    double Linear(int i, int sign) const;
+
+public:
+    explicit P2Quantile(double p);
+
+    void Add(double x);
+    double Probability() const;
+    double Value() const;
+};
+
+P2Quantile::P2Quantile(double p)
+    : p_(p),
+      desired_{1.0, 1.0 + 2.0 * p, 1.0 + 4.0 * p, 3.0 + 2.0 * p, 5.0},
+      increments_{0.0, p / 2.0, p, (1.0 + p) / 2.0, 1.0} {
+    if (p < 0.0 || p > 1.0) {
+        throw std::invalid_argument("Quantile probability must be in [0, 1]");
+    }
+}
+
+// Добавление значения
+void P2Quantile::Add(double x) {
+    if (count_ < 5) {
+        // Вставка с сохранением порядка
+        size_t i = count_;
+        while (i > 0 && heights_[i - 1] > x) {
+            heights_[i] = heights_[i - 1];
+            --i;
+        }
+        heights_[i] = x;
+        ++count_;
+        return;
+    }
+    ++count_;
+
+    // Ячейка, в которую попало значение
+    int cell = 0;
+    if (x < heights_[0]) {
+        heights_[0] = x;
+    } else if (x >= heights_[4]) {
+        heights_[4] = x;
+        cell = 3;
     } else {
-        result.sd = 0.0;
+        while (x >= heights_[cell + 1]) {
+            ++cell;
+        }
     }
-    
-    return result;
-}
\ No newline at end of file
+    for (int i = cell + 1; i < 5; ++i) {
+        positions_[i] += 1.0;
+    }
+    for (int i = 0; i < 5; ++i) {
+        desired_[i] += increments_[i];
+    }
+
+    // Сдвиг средних маркеров к желаемым позициям
+    for (int i = 1; i < 4; ++i) {
+        double d = desired_[i] - positions_[i];
+        if ((d >= 1.0 && positions_[i + 1] - positions_[i] > 1.0) ||
+            (d <= -1.0 && positions_[i - 1] - positions_[i] < -1.0)) {
+            int sign = d > 0.0 ? 1 : -1;
+            double candidate = Parabolic(i, sign);
+            if (heights_[i - 1] < candidate && candidate < heights_[i + 1]) {
+                heights_[i] = candidate;
+            } else {
+                heights_[i] = Linear(i, sign);
+            }
+            positions_[i] += sign;
+        }
+    }
+}
+
+// Параболическая (P²) интерполяция высоты маркера
+double P2Quantile::Parabolic(int i, double sign) const {
+    double left = positions_[i] - positions_[i - 1];
+    double right = positions_[i + 1] - positions_[i];
+    return heights_[i] + sign / (positions_[i + 1] - positions_[i - 1]) *
+        ((left + sign) * (heights_[i + 1] - heights_[i]) / right +
+         (right - sign) * (heights_[i] - heights_[i - 1]) / left);
+}
+
+// Линейная интерполяция, если параболическая нарушает порядок маркеров
+double P2Quantile::Linear(int i, int sign) const {
+    return heights_[i] + sign * (heights_[i + sign] - heights_[i]) /
+        (positions_[i + sign] - positions_[i]);
+}
+
+double P2Quantile::Probability() const {
+    return p_;
+}
+
+// Текущая оценка квантиля
+double P2Quantile::Value() const {
+    if (count_ == 0) {
+        return 0.0;
+    }
+    if (count_ <= 5) {
+        double rank = p_ * static_cast<double>(count_ - 1);
+        size_t lower = static_cast<size_t>(rank);
+        if (lower + 1 >= count_) {
+            return heights_[count_ - 1];
+        }
+        double fraction = rank - static_cast<double>(lower);
+        return heights_[lower] + fraction * (heights_[lower + 1] - heights_[lower]);
+    }
+    return heights_[2];
+}
+
+// Вычисление статистик и квантилей за один проход: данные идут порциями,
+// каждая порция, пока она в кеше, обрабатывается накопителем и оценками
+DataStats CalculateDataStats(const std::vector<int>& data, std::vector<P2Quantile>& quantiles) {
+    constexpr size_t kChunk = 1 << 12;
+    StatsAccumulator accumulator;
+    for (size_t begin = 0; begin < data.size(); begin += kChunk) {
+        size_t size = data.size() - begin < kChunk ? data.size() - begin : kChunk;
+        accumulator.AddRange(data.data() + begin, size);
+        for (P2Quantile& quantile : quantiles) {
+            for (size_t i = begin; i < begin + size; ++i) {
+                quantile.Add(static_cast<double>(data[i]));
+            }
+        }
+    }
+    return accumulator.Result();
+}
+
+// Пул потоков для fork-join задач. Потоки создаются один раз и ждут работы,
+// поэтому повторные параллельные вычисления не платят за создание потоков.
+// Run(count, task) выполняет task(i) для всех i из [0, count) на потоках пула
+// и на вызывающем потоке, затем ждет завершения. Одновременно выполняется
+// один Run, остальные ждут своей очереди
+class ThreadPool {
+private:
+    std::vector<std::thread> workers_;
+    std::mutex run_mutex_;  // очередь вызовов Run
+    std::mutex mutex_;      // состояние текущей задачи
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    std::function<void(size_t)> task_;
+    size_t count_ = 0;
+    size_t next_ = 0;
+    size_t finished_ = 0;
+    size_t generation_ = 0;
+    bool stop_ = false;
+    std::exception_ptr error_;
+
+    void WorkerLoop();
+    void Drain(std::unique_lock<std::mutex>& lock);
+
+public:
+    explicit ThreadPool(size_t threads);
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+    ~ThreadPool();
+
+    size_t Size() const;
+    void Run(size_t count, std::function<void(size_t)> task);
+};
+
+// Общий пул, создается при первом использовании. Вызывающий поток тоже
+// работает, поэтому потоков в пуле на один меньше, чем ядер
+ThreadPool& DefaultThreadPool() {
+    static ThreadPool pool(std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 0);
+    return pool;
+}
+
+ThreadPool::ThreadPool(size_t threads) {
+    workers_.reserve(threads);
+    for (size_t t = 0; t < threads; ++t) {
+        workers_.emplace_back([this] { WorkerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+size_t ThreadPool::Size() const {
+    return workers_.size();
+}
+
+// Поток пула ждет новую задачу (новое поколение) и разбирает ее индексы
+void ThreadPool::WorkerLoop() {
+    size_t seen = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wake_.wait(lock, [this, seen] { return stop_ || generation_ != seen; });
+        if (stop_) {
+            return;
+        }
+        seen = generation_;
+        Drain(lock);
+    }
+}
+
+// Забирает индексы текущей задачи, пока они есть. Задача выполняется без
+// блокировки; последний завершенный индекс будит ожидающий Run
+void ThreadPool::Drain(std::unique_lock<std::mutex>& lock) {
+    while (next_ < count_) {
+        size_t index = next_++;
+        lock.unlock();
+        try {
+            task_(index);
+        } catch (...) {
+            lock.lock();
+            if (!error_) {
+                error_ = std::current_exception();
+            }
+            lock.unlock();
+        }
+        lock.lock();
+        if (++finished_ == count_) {
+            done_.notify_all();
+        }
+    }
+}
+
+// Выполнение task(0), ..., task(count - 1). Первое исключение из задачи
+// пробрасывается после завершения всех индексов
+void ThreadPool::Run(size_t count, std::function<void(size_t)> task) {
+    std::lock_guard<std::mutex> run_lock(run_mutex_);
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_ = std::move(task);
+    count_ = count;
+    next_ = 0;
+    finished_ = 0;
+    error_ = nullptr;
+    ++generation_;
+    wake_.notify_all();
+
+    Drain(lock);
+    done_.wait(lock, [this] { return finished_ == count_; });
+    task_ = nullptr;
+    if (error_) {
+        std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+}
+
+// Меньше этого числа элементов на поток распараллеливание не окупается
+constexpr size_t kMinParallelChunk = 1 << 16;
+
+// Параллельное вычисление на пуле: данные делятся на parts непрерывных
+// отрезков, затем накопители объединяются по порядку, поэтому результат не
+// зависит от планирования потоков
+DataStats CalculateDataStatsParallel(const std::vector<int>& data, ThreadPool& pool, size_t parts) {
+    size_t max_parts = data.size() / kMinParallelChunk;
+    if (parts > max_parts) {
+        parts = max_parts;
+    }
+    if (parts <= 1) {
+        return CalculateDataStats(data);
+    }
+
+    std::vector<StatsAccumulator> partial(parts);
+    pool.Run(parts, [&data, &partial, parts](size_t t) {
+        size_t begin = data.size() * t / parts;
+        size_t end = data.size() * (t + 1) / parts;
+        partial[t].AddRange(data.data() + begin, end - begin);
+    });
+
+    StatsAccumulator total;
+    for (const StatsAccumulator& accumulator : partial) {
+        total.Merge(accumulator);
+    }
+    return total.Result();
+}
+
+// Параллельное вычисление на общем пуле. threads - число отрезков
+// (одновременно работает не больше потоков, чем ядер), 0 - по числу ядер
+DataStats CalculateDataStatsParallel(const std::vector<int>& data, size_t threads = 0) {
+    ThreadPool& pool = DefaultThreadPool();
+    return CalculateDataStatsParallel(data, pool, threads == 0 ? pool.Size() + 1 : threads);
+}
+
+// Потоковое вычисление по бинарным данным (int подряд, порядок байт машины).
+// Память постоянна: данные не загружаются целиком
+
+// Размер порции чтения из потока (в элементах)
+constexpr size_t kStreamChunk = 1 << 14;
+
+// Вычисление по потоку: данные читаются порциями в буфер фиксированного размера
+DataStats CalculateDataStats(std::istream& input) {
+    StatsAccumulator accumulator;
+    std::vector<int> buffer(kStreamChunk);
+    while (input) {
+        input.read(reinterpret_cast<char*>(buffer.data()),
+                   static_cast<std::streamsize>(buffer.size() * sizeof(int)));
+        std::streamsize bytes = input.gcount();
+        if (bytes % static_cast<std::streamsize>(sizeof(int)) != 0) {
+            throw std::runtime_error("Truncated value at the end of the stream");
+        }
+        accumulator.AddRange(buffer.data(), static_cast<size_t>(bytes) / sizeof(int));
+    }
+    return accumulator.Result();
+}
+
+// Окно отображения, после обработки которого страницы отдаются системе
+constexpr size_t kMappedWindow = size_t{64} << 20;
+
+// Вычисление по файлу. Файл отображается в память с подсказкой
+// MADV_SEQUENTIAL (упреждающее чтение), а обработанные окна освобождаются
+// MADV_DONTNEED, поэтому резидентная память не растет с размером файла
+DataStats CalculateDataStatsFromFile(const std::string& path) {
+#if defined(__unix__) || defined(__APPLE__)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw std::runtime_error("Cannot stat " + path);
+    }
+    size_t size = static_cast<size_t>(info.st_size);
+    if (size % sizeof(int) != 0) {
+        ::close(fd);
+        throw std::runtime_error("File size is not a multiple of sizeof(int): " + path);
+    }
+    if (size == 0) {
+        ::close(fd);
+        return DataStats();
+    }
+
+    void* mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // отображение остается действительным
+    if (mapped == MAP_FAILED) {
+        throw std::runtime_error("Cannot map " + path);
+    }
+    ::madvise(mapped, size, MADV_SEQUENTIAL);
+
+    StatsAccumulator accumulator;
+    const char* bytes = static_cast<const char*>(mapped);
+    for (size_t offset = 0; offset < size; offset += kMappedWindow) {
+        size_t window = size - offset < kMappedWindow ? size - offset : kMappedWindow;
+        accumulator.AddRange(reinterpret_cast<const int*>(bytes + offset), window / sizeof(int));
+        ::madvise(const_cast<char*>(bytes + offset), window, MADV_DONTNEED);
+    }
+    ::munmap(mapped, size);
+    return accumulator.Result();
+#else
+    std::ifstream input(path, std::ios::binary);
+    if (!input) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    return CalculateDataStats(input);
+#endif
+}
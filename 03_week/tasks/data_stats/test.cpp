@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
 #include <vector>
 
 #include "data_stats.cpp"
@@ -77,4 +83,204 @@ TEST(DataStatsTest, LargeNumbers) {
 
     EXPECT_DOUBLE_EQ(stats.avg, 60000.0);
     EXPECT_NEAR(stats.sd, std::sqrt(200000000.0 / 3.0), EPSILON);
-}
\ No newline at end of file
+}
+
+TEST(DataStatsTest, AccumulatorMerge) {
+    std::vector<int> vec = {3, -7, 12, 0, 5, 5, 100, -42, 8};
+    StatsAccumulator left;
+    StatsAccumulator right;
+    for (size_t i = 0; i < vec.size(); ++i) {
+        (i < 4 ? left : right).Add(vec[i]);
+    }
+    left.Merge(right);
+    left.Merge(StatsAccumulator());
+
+    DataStats merged = left.Result();
+    DataStats expected = CalculateDataStats(vec);
+    EXPECT_EQ(left.Count(), vec.size());
+    EXPECT_NEAR(merged.avg, expected.avg, EPSILON);
+    EXPECT_NEAR(merged.sd, expected.sd, EPSILON);
+
+    StatsAccumulator empty;
+    empty.Merge(right);
+    EXPECT_DOUBLE_EQ(empty.Mean(), right.Mean());
+}
+
+TEST(DataStatsTest, ParallelMatchesSequential) {
+    std::vector<int> vec(1 << 20);
+    for (size_t i = 0; i < vec.size(); ++i) {
+        vec[i] = static_cast<int>((i * 7919) % 10007) - 5000;
+    }
+    DataStats expected = CalculateDataStats(vec);
+    for (size_t threads : {1, 2, 3, 8, 64}) {
+        DataStats stats = CalculateDataStatsParallel(vec, threads);
+        EXPECT_NEAR(stats.avg, expected.avg, EPSILON) << threads;
+        EXPECT_NEAR(stats.sd, expected.sd, EPSILON) << threads;
+    }
+
+    // Малые данные считаются последовательно
+    std::vector<int> small = {1, 2, 3};
+    EXPECT_DOUBLE_EQ(CalculateDataStatsParallel(small, 4).avg, 2.0);
+    EXPECT_DOUBLE_EQ(CalculateDataStatsParallel({}).sd, 0.0);
+}
+
+TEST(DataStatsTest, LaneKernelsAgree) {
+    std::vector<int> vec(8 * 1000 + 8);
+    for (size_t i = 0; i < vec.size(); ++i) {
+        vec[i] = static_cast<int>((i * 2654435761u) % 200001) - 100000;
+    }
+    size_t blocks = vec.size() / StatsAccumulator::kLanes;
+    LaneMoments scalar;
+    AddLanesScalar(vec.data(), blocks, scalar);
+    LaneMoments dispatched;
+    AddLanes(vec.data(), blocks, dispatched);
+    for (size_t j = 0; j < StatsAccumulator::kLanes; ++j) {
+        EXPECT_DOUBLE_EQ(dispatched.mean[j], scalar.mean[j]) << j;
+        EXPECT_DOUBLE_EQ(dispatched.m2[j], scalar.m2[j]) << j;
+        EXPECT_DOUBLE_EQ(dispatched.m3[j], scalar.m3[j]) << j;
+        EXPECT_DOUBLE_EQ(dispatched.m4[j], scalar.m4[j]) << j;
+        EXPECT_EQ(dispatched.low[j], scalar.low[j]) << j;
+        EXPECT_EQ(dispatched.high[j], scalar.high[j]) << j;
+    }
+}
+
+TEST(DataStatsTest, ThreadPoolRunsEveryIndex) {
+    for (size_t threads : {0, 1, 4}) {
+        ThreadPool pool(threads);
+        EXPECT_EQ(pool.Size(), threads);
+        // Пул переиспользуется: потоки создаются один раз
+        for (size_t round = 0; round < 20; ++round) {
+            std::vector<int> hits(100, 0);
+            pool.Run(hits.size(), [&hits](size_t i) { ++hits[i]; });
+            EXPECT_EQ(std::count(hits.begin(), hits.end(), 1), 100) << threads;
+        }
+        EXPECT_THROW(pool.Run(10, [](size_t i) {
+            if (i == 7) {
+                throw std::runtime_error("task failed");
+            }
+        }), std::runtime_error);
+        pool.Run(0, [](size_t) {});
+    }
+}
+
+TEST(DataStatsTest, ParallelOnOwnPool) {
+    std::vector<int> vec(1 << 20);
+    for (size_t i = 0; i < vec.size(); ++i) {
+        vec[i] = static_cast<int>((i * 104729) % 65537) - 30000;
+    }
+    DataStats expected = CalculateDataStats(vec);
+    ThreadPool pool(3);
+    for (size_t parts : {2, 4, 16}) {
+        DataStats stats = CalculateDataStatsParallel(vec, pool, parts);
+        EXPECT_NEAR(stats.avg, expected.avg, EPSILON) << parts;
+        EXPECT_NEAR(stats.sd, expected.sd, EPSILON) << parts;
+        EXPECT_EQ(stats.min, expected.min);
+        EXPECT_EQ(stats.max, expected.max);
+    }
+}
+
+// Записывает значения во временный бинарный файл. К имени добавляется
+// случайный суффикс: тестовые программы (обычная и с TSan) могут идти одновременно
+std::string WriteBinaryFile(const std::string& name, const std::vector<int>& values) {
+    static const std::string suffix = std::to_string(std::random_device{}()) + "_" +
+        std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+    std::string path = (std::filesystem::temp_directory_path() / (name + "." + suffix + ".bin")).string();
+    std::ofstream output(path, std::ios::binary | std::ios::trunc);
+    output.write(reinterpret_cast<const char*>(values.data()),
+                 static_cast<std::streamsize>(values.size() * sizeof(int)));
+    return path;
+}
+
+TEST(DataStatsTest, StreamMatchesVector) {
+    std::vector<int> vec(100000);
+    for (size_t i = 0; i < vec.size(); ++i) {
+        vec[i] = static_cast<int>((i * 31) % 1000) - 500;
+    }
+    std::string bytes(reinterpret_cast<const char*>(vec.data()), vec.size() * sizeof(int));
+    std::istringstream input(bytes);
+
+    DataStats stats = CalculateDataStats(input);
+    DataStats expected = CalculateDataStats(vec);
+    EXPECT_NEAR(stats.avg, expected.avg, EPSILON);
+    EXPECT_NEAR(stats.sd, expected.sd, EPSILON);
+
+    std::istringstream truncated(bytes.substr(0, 10));
+    EXPECT_THROW(CalculateDataStats(truncated), std::runtime_error);
+}
+
+TEST(DataStatsTest, MappedFileMatchesVector) {
+    std::vector<int> vec = {-2, -1, 0, 1, 2, 1000, -1000};
+    std::string path = WriteBinaryFile("data_stats_test", vec);
+
+    DataStats stats = CalculateDataStatsFromFile(path);
+    DataStats expected = CalculateDataStats(vec);
+    EXPECT_NEAR(stats.avg, expected.avg, EPSILON);
+    EXPECT_NEAR(stats.sd, expected.sd, EPSILON);
+
+    std::string empty = WriteBinaryFile("data_stats_empty", {});
+    EXPECT_DOUBLE_EQ(CalculateDataStatsFromFile(empty).avg, 0.0);
+    EXPECT_THROW(CalculateDataStatsFromFile(path + ".missing"), std::runtime_error);
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(empty);
+}
+
+TEST(DataStatsTest, LaneKernelMatchesSequential) {
+    std::vector<int> vec(10007);
+    for (size_t i = 0; i < vec.size(); ++i) {
+        vec[i] = static_cast<int>((i * i * 37) % 1013) - 300;
+    }
+    StatsAccumulator sequential;
+    for (int value : vec) {
+        sequential.Add(value);
+    }
+    DataStats expected = sequential.Result();
+    DataStats stats = CalculateDataStats(vec);
+
+    EXPECT_NEAR(stats.avg, expected.avg, EPSILON);
+    EXPECT_NEAR(stats.sd, expected.sd, EPSILON);
+    EXPECT_NEAR(stats.skewness, expected.skewness, EPSILON);
+    EXPECT_NEAR(stats.kurtosis, expected.kurtosis, EPSILON);
+    EXPECT_DOUBLE_EQ(stats.min, expected.min);
+    EXPECT_DOUBLE_EQ(stats.max, expected.max);
+}
+
+TEST(DataStatsTest, ExtendedStats) {
+    // Выборка 1, 2, 3, 4, 10: среднее 4, суммы степеней отклонений
+    // m2 = 50, m3 = 180, m4 = 1394
+    std::vector<int> vec = {1, 2, 3, 4, 10};
+    DataStats stats = CalculateDataStats(vec);
+    EXPECT_DOUBLE_EQ(stats.min, 1.0);
+    EXPECT_DOUBLE_EQ(stats.max, 10.0);
+    EXPECT_NEAR(stats.skewness, std::sqrt(5.0) * 180.0 / std::pow(50.0, 1.5), EPSILON);
+    EXPECT_NEAR(stats.kurtosis, 5.0 * 1394.0 / 2500.0 - 3.0, EPSILON);
+
+    // Симметричные данные - нулевая асимметрия, постоянные - нулевые моменты
+    EXPECT_NEAR(CalculateDataStats({-3, -1, 0, 1, 3}).skewness, 0.0, EPSILON);
+    DataStats constant = CalculateDataStats(std::vector<int>(100, 7));
+    EXPECT_DOUBLE_EQ(constant.skewness, 0.0);
+    EXPECT_DOUBLE_EQ(constant.kurtosis, 0.0);
+    EXPECT_DOUBLE_EQ(constant.min, 7.0);
+}
+
+TEST(DataStatsTest, StreamingQuantiles) {
+    std::vector<int> vec(100001);
+    for (size_t i = 0; i < vec.size(); ++i) {
+        vec[i] = static_cast<int>((i * 7919) % vec.size());  // перестановка 0..100000
+    }
+    std::vector<P2Quantile> quantiles = {P2Quantile(0.5), P2Quantile(0.9), P2Quantile(0.99)};
+    DataStats stats = CalculateDataStats(vec, quantiles);
+
+    EXPECT_NEAR(stats.avg, 50000.0, EPSILON);
+    EXPECT_NEAR(quantiles[0].Value(), 50000.0, 500.0);
+    EXPECT_NEAR(quantiles[1].Value(), 90000.0, 500.0);
+    EXPECT_NEAR(quantiles[2].Value(), 99000.0, 500.0);
+
+    // До пяти значений квантиль точный
+    P2Quantile median(0.5);
+    for (double x : {5.0, 1.0, 3.0}) {
+        median.Add(x);
+    }
+    EXPECT_DOUBLE_EQ(median.Value(), 3.0);
+    EXPECT_THROW(P2Quantile(1.5), std::invalid_argument);
+}
@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "filter.cpp"
+
+// Время выполнения body в наносекундах на один из elements элементов
+template<typename Body>
+double NanosecondsPerElement(size_t elements, Body body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(finish - start).count() / static_cast<double>(elements);
+}
+
+// Порог для предиката-функции: указатель на нее непрозрачен для компилятора
+int threshold = 0;
+
+bool AboveThreshold(int x) {
+    return x > threshold;
+}
+
+// Сравнение предикатов на одних и тех же данных: указатель на функцию,
+// лямбда (скалярное сжатие без ветвлений) и Greater (ядро AVX2).
+// Копия исходных данных делается вне замера
+void BenchmarkPredicates(const std::vector<int>& source) {
+    std::printf("Filter of %zu ints, ns/element\n", source.size());
+    std::printf("%10s %12s %12s %12s\n", "kept", "pointer", "lambda", "Greater");
+
+    // Указатель читается через volatile, чтобы вызов не встроился
+    bool (*volatile pointer)(int) = AboveThreshold;
+    std::vector<int> vec;
+    for (int kept_percent : {10, 50, 90}) {
+        threshold = 1000 - kept_percent * 10 - 1;
+        const int bound = threshold;
+
+        auto run = [&](auto filter) {
+            vec = source;
+            double ns = NanosecondsPerElement(source.size(), [&] { filter(vec); });
+            asm volatile("" : : "r"(vec.data()) : "memory");
+            return ns;
+        };
+        double pointer_ns = run([&](std::vector<int>& v) { Filter(v, pointer); });
+        double lambda_ns = run([&](std::vector<int>& v) { Filter(v, [bound](int x) { return x > bound; }); });
+        double greater_ns = run([&](std::vector<int>& v) { Filter(v, Greater{bound}); });
+        std::printf("%9d%% %12.3f %12.3f %12.3f\n", kept_percent, pointer_ns, lambda_ns, greater_ns);
+    }
+}
+
+// Кривая масштабирования FilterParallel: время на элемент и ускорение
+// относительно одного потока при 50% оставленных элементов
+void BenchmarkScaling(const std::vector<int>& source) {
+    std::printf("\nFilterParallel of %zu ints, 50%% kept\n", source.size());
+    std::printf("%8s %12s %10s\n", "threads", "ns/element", "speedup");
+
+    const size_t max_threads = std::max<size_t>(std::thread::hardware_concurrency(), 8);
+    std::vector<int> vec;
+    double single_ns = 0;
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        vec = source;
+        double ns = NanosecondsPerElement(source.size(), [&] { FilterParallel(vec, Greater{499}, threads); });
+        asm volatile("" : : "r"(vec.data()) : "memory");
+        if (threads == 1) {
+            single_ns = ns;
+        }
+        std::printf("%8zu %12.3f %10.2f\n", threads, ns, single_ns / ns);
+    }
+}
+
+// Аргумент - число элементов
+int main(int argc, char** argv) {
+    size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100'000'000;
+
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> value_dist(0, 999);
+    std::vector<int> source(size);
+    for (auto& value : source) {
+        value = value_dist(gen);
+    }
+
+    BenchmarkPredicates(source);
+    BenchmarkScaling(source);
+    return 0;
+}
@@ -1,5 +1,16 @@
 #include <vector>
 #include <functional>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <type_traits>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#endif
 
 /*
 Фильтрует вектор целых чисел по заданному предикату.
@@ -28,4 +39,236 @@ void Filter(std::vector<int>& vec, bool (*predicate)(int)) {
 
     // Удаляем лишние элементы из конца вектора
     vec.resize(write_index);
-}
\ No newline at end of file
+}
+
+// Предикаты-сравнения. В отличие от указателя на функцию их тип известен
+// компилятору, поэтому вызов встраивается, а Filter выбирает для них
+// векторное ядро сжатия
+struct Less {
+    int bound;
+    constexpr bool operator()(int x) const;
+};
+
+struct Greater {
+    int bound;
+    constexpr bool operator()(int x) const;
+};
+
+// Отрезок [low, high]; при low > high не подходит ни одно значение
+struct InRange {
+    int low;
+    int high;
+    constexpr bool operator()(int x) const;
+};
+
+struct Equals {
+    int value;
+    constexpr bool operator()(int x) const;
+};
+
+constexpr bool Less::operator()(int x) const {
+    return x < bound;
+}
+
+constexpr bool Greater::operator()(int x) const {
+    return x > bound;
+}
+
+constexpr bool InRange::operator()(int x) const {
+    return low <= x && x <= high;
+}
+
+constexpr bool Equals::operator()(int x) const {
+    return x == value;
+}
+
+// Предикаты, которые сводятся к проверке попадания в отрезок
+template<typename Predicate>
+concept ComparisonPredicate = std::same_as<Predicate, Less> || std::same_as<Predicate, Greater> ||
+                              std::same_as<Predicate, InRange> || std::same_as<Predicate, Equals>;
+
+// Любое сравнение выражается отрезком - одно ядро обслуживает все четыре вида
+constexpr InRange AsRange(Less predicate) {
+    if (predicate.bound == std::numeric_limits<int>::min()) {
+        return InRange{1, 0};
+    }
+    return InRange{std::numeric_limits<int>::min(), predicate.bound - 1};
+}
+
+constexpr InRange AsRange(Greater predicate) {
+    if (predicate.bound == std::numeric_limits<int>::max()) {
+        return InRange{1, 0};
+    }
+    return InRange{predicate.bound + 1, std::numeric_limits<int>::max()};
+}
+
+constexpr InRange AsRange(InRange predicate) {
+    return predicate;
+}
+
+constexpr InRange AsRange(Equals predicate) {
+    return InRange{predicate.value, predicate.value};
+}
+
+// Скалярное сжатие без ветвлений: элемент записывается всегда, а позиция
+// записи сдвигается на результат предиката. Непредсказуемый предикат не
+// приводит к промахам предсказателя переходов
+template<typename Predicate>
+size_t CompactScalar(int* data, size_t size, Predicate& predicate) {
+    size_t write_index = 0;
+    for (size_t i = 0; i < size; ++i) {
+        const int value = data[i];
+        data[write_index] = value;
+        write_index += static_cast<bool>(std::invoke(predicate, value));
+    }
+    return write_index;
+}
+
+#if defined(__x86_64__) && defined(__GNUC__)
+// Таблица перестановок: для каждой 8-битной маски - номера выбранных дорожек,
+// прижатые к началу регистра (хвост заполняется чем угодно)
+constexpr std::array<std::array<int32_t, 8>, 256> MakeCompactionTable() {
+    std::array<std::array<int32_t, 8>, 256> table{};
+    for (size_t mask = 0; mask < 256; ++mask) {
+        size_t lane = 0;
+        for (int32_t bit = 0; bit < 8; ++bit) {
+            if (mask & (size_t{1} << bit)) {
+                table[mask][lane++] = bit;
+            }
+        }
+    }
+    return table;
+}
+
+inline constexpr std::array<std::array<int32_t, 8>, 256> kCompactionTable = MakeCompactionTable();
+
+// Проверка поддержки AVX2 процессором выполняется один раз
+bool CpuHasAvx2() {
+    static const bool has_avx2 = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return has_avx2;
+}
+
+// Ядро AVX2: сравнение восьми элементов, маска через movemask, перестановка
+// выбранных элементов в начало регистра и запись всех восьми дорожек.
+// Запись идет по индексу write_index <= i, поэтому затирает только уже
+// прочитанные элементы
+__attribute__((target("avx2,popcnt")))
+size_t CompactRangeAvx2(int* data, size_t size, InRange range) {
+    const __m256i low = _mm256_set1_epi32(range.low);
+    const __m256i high = _mm256_set1_epi32(range.high);
+
+    size_t write_index = 0;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const __m256i rejected = _mm256_or_si256(_mm256_cmpgt_epi32(low, values),
+                                                 _mm256_cmpgt_epi32(values, high));
+        const unsigned mask = ~static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(rejected))) & 0xFFu;
+        const __m256i permutation = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(kCompactionTable[mask].data()));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + write_index),
+                            _mm256_permutevar8x32_epi32(values, permutation));
+        write_index += static_cast<size_t>(__builtin_popcount(mask));
+    }
+
+    // Хвост короче регистра
+    for (; i < size; ++i) {
+        const int value = data[i];
+        data[write_index] = value;
+        write_index += range(value);
+    }
+    return write_index;
+}
+#endif
+
+// Сжатие по отрезку: векторное ядро, если процессор его поддерживает
+size_t CompactRange(int* data, size_t size, InRange range) {
+#if defined(__x86_64__) && defined(__GNUC__)
+    if (CpuHasAvx2()) {
+        return CompactRangeAvx2(data, size, range);
+    }
+#endif
+    return CompactScalar(data, size, range);
+}
+
+// Сжатие отрезка на месте: предикаты сравнения - векторным ядром,
+// остальные - скалярным сжатием без ветвлений. Возвращает число оставленных
+template<typename Predicate>
+size_t Compact(int* data, size_t size, Predicate& predicate) {
+    if constexpr (ComparisonPredicate<Predicate>) {
+        return CompactRange(data, size, AsRange(predicate));
+    } else {
+        return CompactScalar(data, size, predicate);
+    }
+}
+
+// Фильтр с произвольным вызываемым объектом (лямбда, функтор).
+// Указатель на функцию по-прежнему попадает в перегрузку выше
+template<typename Predicate> requires std::predicate<Predicate&, int>
+void Filter(std::vector<int>& vec, Predicate predicate) {
+    vec.resize(Compact(vec.data(), vec.size(), predicate));
+}
+
+// Меньше этого числа элементов на поток распараллеливание не окупается
+constexpr size_t kMinParallelChunk = 1 << 16;
+
+// Число потоков для size элементов: 0 - по числу ядер, но не больше,
+// чем позволяет kMinParallelChunk
+size_t ParallelThreads(size_t size, size_t threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    size_t max_threads = size / kMinParallelChunk;
+    return threads < max_threads ? threads : max_threads;
+}
+
+// Параллельный фильтр. Каждый поток сжимает свой непрерывный отрезок на месте
+// и возвращает число оставленных элементов; исключающая префиксная сумма этих
+// чисел дает смещение каждого отрезка в результате. Затем отрезки сдвигаются
+// к своим смещениям по порядку: смещение отрезка не больше его начала, и
+// сдвиг отрезка t не задевает еще не сдвинутые отрезки t+1, t+2, ...
+// Параллельный сдвиг здесь невозможен - приемник отрезка t может пересекаться
+// с источником отрезка t-1. Порядок элементов тот же, что у Filter.
+// 0 потоков - по числу ядер
+template<typename Predicate> requires std::predicate<Predicate&, int>
+void FilterParallel(std::vector<int>& vec, Predicate predicate, size_t threads = 0) {
+    if constexpr (std::is_pointer_v<Predicate>) {
+        if (!predicate) {
+            return;
+        }
+    }
+    threads = ParallelThreads(vec.size(), threads);
+    if (threads <= 1) {
+        vec.resize(Compact(vec.data(), vec.size(), predicate));
+        return;
+    }
+
+    // Подсчет: каждый поток сжимает свой отрезок
+    std::vector<size_t> counts(threads);
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (size_t t = 0; t < threads; ++t) {
+        size_t begin = vec.size() * t / threads;
+        size_t end = vec.size() * (t + 1) / threads;
+        workers.emplace_back([&vec, &counts, predicate, t, begin, end]() mutable {
+            counts[t] = Compact(vec.data() + begin, end - begin, predicate);
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Префиксная сумма и сдвиг отрезков к их смещениям
+    size_t offset = 0;
+    for (size_t t = 0; t < threads; ++t) {
+        size_t begin = vec.size() * t / threads;
+        if (offset != begin && counts[t] != 0) {
+            std::memmove(vec.data() + offset, vec.data() + begin, counts[t] * sizeof(int));
+        }
+        offset += counts[t];
+    }
+    vec.resize(offset);
+}
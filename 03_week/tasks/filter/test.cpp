@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <limits>
 #include <random>
 #include <vector>
 
@@ -169,4 +170,184 @@ TEST(FilterTest, BigRandomDataMultipleSeeds) {
     EXPECT_LE(filter_duration, 1.2 * erase_duration)
         << "Function too slow: "
         <<"filter_duration = " << filter_duration << " ms, erase_duration = " << erase_duration << " ms\n";
-}
\ No newline at end of file
+}
+
+TEST(FilterTest, LambdaPredicate) {
+    std::vector<int> vec = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    int divisor = 3;
+    Filter(vec, [divisor](int x) { return x % divisor == 0; });
+    std::vector<int> expected = {3, 6, 9};
+    EXPECT_EQ(vec, expected);
+}
+
+TEST(FilterTest, ComparisonPredicates) {
+    std::vector<int> source = {5, -3, 8, 0, 12, 7, -1, 8, 3, 10, 8, -20};
+
+    auto vec = source;
+    Filter(vec, Less{5});
+    EXPECT_EQ(vec, (std::vector<int>{-3, 0, -1, 3, -20}));
+
+    vec = source;
+    Filter(vec, Greater{5});
+    EXPECT_EQ(vec, (std::vector<int>{8, 12, 7, 8, 10, 8}));
+
+    vec = source;
+    Filter(vec, InRange{0, 8});
+    EXPECT_EQ(vec, (std::vector<int>{5, 8, 0, 7, 8, 3, 8}));
+
+    vec = source;
+    Filter(vec, Equals{8});
+    EXPECT_EQ(vec, (std::vector<int>{8, 8, 8}));
+}
+
+TEST(FilterTest, ComparisonPredicatesExtremeBounds) {
+    const int min = std::numeric_limits<int>::min();
+    const int max = std::numeric_limits<int>::max();
+    std::vector<int> source = {min, -1, 0, 1, max, min, max, 2, 3};
+
+    auto vec = source;
+    Filter(vec, Less{min});
+    EXPECT_TRUE(vec.empty());
+
+    vec = source;
+    Filter(vec, Greater{max});
+    EXPECT_TRUE(vec.empty());
+
+    vec = source;
+    Filter(vec, InRange{min, max});
+    EXPECT_EQ(vec, source);
+
+    vec = source;
+    Filter(vec, InRange{1, 0});
+    EXPECT_TRUE(vec.empty());
+
+    vec = source;
+    Filter(vec, Greater{min});
+    EXPECT_EQ(vec, (std::vector<int>{-1, 0, 1, max, max, 2, 3}));
+}
+
+TEST(FilterTest, ComparisonNotRealocate) {
+    std::vector<int> vec(1000);
+    for (size_t i = 0; i < vec.size(); ++i) {
+        vec[i] = static_cast<int>(i);
+    }
+    auto capacity = vec.capacity();
+    auto ptr_before = vec.data();
+    Filter(vec, InRange{100, 199});
+    EXPECT_EQ(vec.data(), ptr_before);
+    EXPECT_EQ(vec.capacity(), capacity);
+    ASSERT_EQ(vec.size(), 100);
+    for (size_t i = 0; i < vec.size(); ++i) {
+        EXPECT_EQ(vec[i], static_cast<int>(i + 100));
+    }
+}
+
+TEST(FilterTest, ComparisonMatchesFunctionPointer) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> value_dist(-100, 100);
+
+    // Размеры вокруг ширины регистра проверяют обработку хвоста
+    for (size_t size : {0u, 1u, 7u, 8u, 9u, 15u, 16u, 17u, 1000u, 1003u}) {
+        std::vector<int> test(size);
+        for (auto& value : test) {
+            value = value_dist(gen);
+        }
+
+        auto expected = test;
+        Filter(expected, IsPositive);
+        Filter(test, Greater{0});
+        EXPECT_EQ(test, expected) << "size = " << size;
+    }
+}
+
+TEST(FilterTest, ComparisonFasterThanFunctionPointer) {
+#if defined(__SANITIZE_THREAD__)
+    // Под TSan время выполнения не показательно
+    GTEST_SKIP() << "timing test is meaningless under ThreadSanitizer";
+#endif
+    const size_t NUM_TESTS = 5;
+    const size_t VECTOR_SIZE = 10'000'000;
+
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> value_dist(-1'000'000, 1'000'000);
+    std::vector<int> source(VECTOR_SIZE);
+    for (auto& value : source) {
+        value = value_dist(gen);
+    }
+
+    double pointer_duration = 0;
+    double comparison_duration = 0;
+    for (size_t test_idx = 0; test_idx < NUM_TESTS; ++test_idx) {
+        auto expected = source;
+        auto start = std::chrono::high_resolution_clock::now();
+        Filter(expected, IsPositive);
+        auto end = std::chrono::high_resolution_clock::now();
+        pointer_duration += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        auto test = source;
+        start = std::chrono::high_resolution_clock::now();
+        Filter(test, Greater{0});
+        end = std::chrono::high_resolution_clock::now();
+        comparison_duration += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        ASSERT_EQ(test, expected);
+    }
+
+    // Запас 10% на шум таймера
+    EXPECT_LE(comparison_duration, pointer_duration * 1.1)
+        << "Comparison predicate too slow: "
+        << "comparison_duration = " << comparison_duration << " us, "
+        << "pointer_duration = " << pointer_duration << " us\n";
+}
+
+TEST(FilterTest, ParallelSmallInput) {
+    std::vector<int> vec = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    FilterParallel(vec, IsEven, 4);
+    std::vector<int> expected = {2, 4, 6, 8, 10};
+    EXPECT_EQ(vec, expected);
+}
+
+TEST(FilterTest, ParallelNullptrPredicate) {
+    std::vector<int> vec(kMinParallelChunk * 4, 1);
+    bool (*predicate)(int) = nullptr;
+    FilterParallel(vec, predicate, 4);
+    EXPECT_EQ(vec.size(), kMinParallelChunk * 4);
+}
+
+TEST(FilterTest, ParallelMatchesSequential) {
+    std::mt19937 gen(11);
+    std::uniform_int_distribution<int> value_dist(-1000, 1000);
+    std::vector<int> source(kMinParallelChunk * 8 + 123);
+    for (auto& value : source) {
+        value = value_dist(gen);
+    }
+
+    auto expected = source;
+    Filter(expected, IsEven);
+    for (size_t threads : {1u, 2u, 3u, 5u, 8u}) {
+        auto test = source;
+        auto ptr_before = test.data();
+        FilterParallel(test, IsEven, threads);
+        EXPECT_EQ(test, expected) << "threads = " << threads;
+        EXPECT_EQ(test.data(), ptr_before);
+    }
+
+    expected = source;
+    Filter(expected, InRange{-10, 500});
+    auto test = source;
+    FilterParallel(test, InRange{-10, 500});
+    EXPECT_EQ(test, expected);
+}
+
+TEST(FilterTest, ParallelSkewedMatches) {
+    // Первая половина отбрасывается целиком - отрезки сдвигаются далеко влево
+    std::vector<int> vec(kMinParallelChunk * 4);
+    for (size_t i = 0; i < vec.size(); ++i) {
+        vec[i] = i < vec.size() / 2 ? -1 : static_cast<int>(i);
+    }
+    FilterParallel(vec, Greater{0}, 4);
+    ASSERT_EQ(vec.size(), kMinParallelChunk * 2);
+    for (size_t i = 0; i < vec.size(); ++i) {
+        EXPECT_EQ(vec[i], static_cast<int>(i + kMinParallelChunk * 2));
+    }
+}
@@ -0,0 +1,54 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "find_all.cpp"
+
+// Время выполнения body в наносекундах на один из elements элементов
+template<typename Body>
+double NanosecondsPerElement(size_t elements, Body body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(finish - start).count() / static_cast<double>(elements);
+}
+
+// Кривая масштабирования FindAllParallel: время на элемент и ускорение
+// относительно одного потока при 50% совпадений
+void BenchmarkScaling(const std::vector<int>& source) {
+    std::printf("FindAllParallel of %zu ints, 50%% matches\n", source.size());
+    std::printf("%8s %12s %10s\n", "threads", "ns/element", "speedup");
+
+    const size_t max_threads = std::max<size_t>(std::thread::hardware_concurrency(), 8);
+    double single_ns = 0;
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        std::vector<size_t> result;
+        double ns = NanosecondsPerElement(source.size(), [&] {
+            result = FindAllParallel(source, Greater{499}, threads);
+        });
+        asm volatile("" : : "r"(result.data()) : "memory");
+        if (threads == 1) {
+            single_ns = ns;
+        }
+        std::printf("%8zu %12.3f %10.2f\n", threads, ns, single_ns / ns);
+    }
+}
+
+// Аргумент - число элементов
+int main(int argc, char** argv) {
+    size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 50'000'000;
+
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> value_dist(0, 999);
+    std::vector<int> source(size);
+    for (auto& value : source) {
+        value = value_dist(gen);
+    }
+
+    BenchmarkScaling(source);
+    return 0;
+}
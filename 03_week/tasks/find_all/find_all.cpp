@@ -1,4 +1,19 @@
 #include <vector>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#endif
 
 /*Функция, которая возвращает контейнер позиций всех 
 элементов, удовлетворяющих предикату.*/
@@ -19,4 +34,586 @@ std::vector<size_t> FindAll(const std::vector<int>& vec
     
     result.shrink_to_fit(); //подгоняем под количество элементов 
     return result;
-}
\ No newline at end of file
+}
+
+// Предикаты-сравнения. Их тип известен компилятору, поэтому вызов
+// встраивается, а FindAllBitmap выбирает для них векторное ядро
+struct Less {
+    int bound;
+    constexpr bool operator()(int x) const;
+};
+
+struct Greater {
+    int bound;
+    constexpr bool operator()(int x) const;
+};
+
+// Отрезок [low, high]; при low > high не подходит ни одно значение
+struct InRange {
+    int low;
+    int high;
+    constexpr bool operator()(int x) const;
+};
+
+struct Equals {
+    int value;
+    constexpr bool operator()(int x) const;
+};
+
+constexpr bool Less::operator()(int x) const {
+    return x < bound;
+}
+
+constexpr bool Greater::operator()(int x) const {
+    return x > bound;
+}
+
+constexpr bool InRange::operator()(int x) const {
+    return low <= x && x <= high;
+}
+
+constexpr bool Equals::operator()(int x) const {
+    return x == value;
+}
+
+// Предикаты, которые сводятся к проверке попадания в отрезок
+template<typename Predicate>
+concept ComparisonPredicate = std::same_as<Predicate, Less> || std::same_as<Predicate, Greater> ||
+                              std::same_as<Predicate, InRange> || std::same_as<Predicate, Equals>;
+
+// Любое сравнение выражается отрезком - одно ядро обслуживает все четыре вида
+constexpr InRange AsRange(Less predicate) {
+    if (predicate.bound == std::numeric_limits<int>::min()) {
+        return InRange{1, 0};
+    }
+    return InRange{std::numeric_limits<int>::min(), predicate.bound - 1};
+}
+
+constexpr InRange AsRange(Greater predicate) {
+    if (predicate.bound == std::numeric_limits<int>::max()) {
+        return InRange{1, 0};
+    }
+    return InRange{predicate.bound + 1, std::numeric_limits<int>::max()};
+}
+
+constexpr InRange AsRange(InRange predicate) {
+    return predicate;
+}
+
+constexpr InRange AsRange(Equals predicate) {
+    return InRange{predicate.value, predicate.value};
+}
+
+// Меньше этого числа элементов на поток распараллеливание не окупается
+constexpr size_t kMinParallelChunk = 1 << 16;
+
+// Число потоков для size элементов: 0 - по числу ядер, но не больше,
+// чем позволяет kMinParallelChunk
+size_t ParallelThreads(size_t size, size_t threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    size_t max_threads = size / kMinParallelChunk;
+    return threads < max_threads ? threads : max_threads;
+}
+
+// Число элементов отрезка [begin, end), удовлетворяющих предикату
+template<typename Predicate>
+size_t CountMatches(const int* data, size_t begin, size_t end, Predicate& predicate) {
+    size_t count = 0;
+    for (size_t i = begin; i < end; ++i) {
+        count += static_cast<bool>(std::invoke(predicate, data[i]));
+    }
+    return count;
+}
+
+// Запись позиций подходящих элементов отрезка [begin, end) начиная с out
+template<typename Predicate>
+void ScatterMatches(const int* data, size_t begin, size_t end, Predicate& predicate, size_t* out) {
+    size_t written = 0;
+    for (size_t i = begin; i < end; ++i) {
+        if (std::invoke(predicate, data[i])) {
+            out[written++] = i;
+        }
+    }
+}
+
+// Параллельный поиск позиций. Три прохода: каждый поток считает совпадения
+// в своем непрерывном отрезке, исключающая префиксная сумма дает смещение
+// отрезка в результате, затем каждый поток пишет позиции в свою часть
+// результата. Части не пересекаются, порядок тот же, что у FindAll.
+// 0 потоков - по числу ядер
+template<typename Predicate> requires std::predicate<Predicate&, int>
+std::vector<size_t> FindAllParallel(const std::vector<int>& vec, Predicate predicate, size_t threads = 0) {
+    if constexpr (std::is_pointer_v<Predicate>) {
+        if (!predicate) {
+            return {};
+        }
+    }
+    threads = ParallelThreads(vec.size(), threads);
+    if (threads <= 1) {
+        std::vector<size_t> result(CountMatches(vec.data(), 0, vec.size(), predicate));
+        ScatterMatches(vec.data(), 0, vec.size(), predicate, result.data());
+        return result;
+    }
+
+    // Подсчет совпадений по отрезкам
+    std::vector<size_t> offsets(threads);
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (size_t t = 0; t < threads; ++t) {
+        size_t begin = vec.size() * t / threads;
+        size_t end = vec.size() * (t + 1) / threads;
+        workers.emplace_back([&vec, &offsets, predicate, t, begin, end]() mutable {
+            offsets[t] = CountMatches(vec.data(), begin, end, predicate);
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Исключающая префиксная сумма
+    size_t total = 0;
+    for (size_t t = 0; t < threads; ++t) {
+        size_t count = offsets[t];
+        offsets[t] = total;
+        total += count;
+    }
+
+    // Запись позиций: каждый поток в свою часть результата
+    std::vector<size_t> result(total);
+    workers.clear();
+    for (size_t t = 0; t < threads; ++t) {
+        size_t begin = vec.size() * t / threads;
+        size_t end = vec.size() * (t + 1) / threads;
+        workers.emplace_back([&vec, &result, &offsets, predicate, t, begin, end]() mutable {
+            ScatterMatches(vec.data(), begin, end, predicate, result.data() + offsets[t]);
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return result;
+}
+
+// Комбинаторы предикатов: AllOf - все предикаты истинны, AnyOf - хотя бы один.
+// Позволяют искать по нескольким условиям за один проход, не строя
+// промежуточные векторы позиций
+template<typename... Predicates>
+class AllOf {
+private:
+    std::tuple<Predicates...> predicates_;
+
+public:
+    constexpr explicit AllOf(Predicates... predicates);
+    constexpr bool operator()(int x) const;
+};
+
+template<typename... Predicates>
+class AnyOf {
+private:
+    std::tuple<Predicates...> predicates_;
+
+public:
+    constexpr explicit AnyOf(Predicates... predicates);
+    constexpr bool operator()(int x) const;
+};
+
+template<typename... Predicates>
+constexpr AllOf<Predicates...>::AllOf(Predicates... predicates) : predicates_(std::move(predicates)...) {}
+
+template<typename... Predicates>
+constexpr bool AllOf<Predicates...>::operator()(int x) const {
+    return std::apply([x](const auto&... predicate) {
+        return (static_cast<bool>(std::invoke(predicate, x)) && ...);
+    }, predicates_);
+}
+
+template<typename... Predicates>
+constexpr AnyOf<Predicates...>::AnyOf(Predicates... predicates) : predicates_(std::move(predicates)...) {}
+
+template<typename... Predicates>
+constexpr bool AnyOf<Predicates...>::operator()(int x) const {
+    return std::apply([x](const auto&... predicate) {
+        return (static_cast<bool>(std::invoke(predicate, x)) || ...);
+    }, predicates_);
+}
+
+// Битовая маска выбора: бит i установлен, если элемент i удовлетворяет
+// предикату. Занимает 1 бит на элемент вместо 8 байт на найденную позицию.
+// Маски одного размера объединяются операциями & и | по 64 элемента за раз.
+// Биты за пределами Size() всегда нулевые
+class SelectionBitmap {
+public:
+    static constexpr size_t kWordBits = 64;
+
+    // Итератор по установленным битам: позиции выдаются по запросу
+    class Iterator {
+    private:
+        const uint64_t* words_;
+        size_t word_count_;
+        size_t word_index_;
+        uint64_t current_;
+
+        void SkipEmptyWords();
+
+    public:
+        using value_type = size_t;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator();
+        Iterator(const uint64_t* words, size_t word_count, size_t word_index);
+
+        size_t operator*() const;
+        Iterator& operator++();
+        Iterator operator++(int);
+        bool operator==(const Iterator& other) const;
+    };
+
+private:
+    std::vector<uint64_t> words_;
+    size_t size_;
+
+public:
+    SelectionBitmap();
+    explicit SelectionBitmap(size_t size);
+
+    size_t Size() const;
+    size_t Count() const;
+    bool Test(size_t index) const;
+    void Set(size_t index);
+
+    // Слова маски (для заполнения векторными ядрами)
+    uint64_t* Words();
+    const uint64_t* Words() const;
+    size_t WordCount() const;
+
+    // Материализация позиций - как результат FindAll
+    std::vector<size_t> Indices() const;
+
+    Iterator begin() const;
+    Iterator end() const;
+
+    SelectionBitmap& operator&=(const SelectionBitmap& other);
+    SelectionBitmap& operator|=(const SelectionBitmap& other);
+};
+
+// Конструктор итератора конца по умолчанию
+SelectionBitmap::Iterator::Iterator() : words_(nullptr), word_count_(0), word_index_(0), current_(0) {}
+
+// Итератор, стоящий на первом установленном бите начиная со слова word_index
+SelectionBitmap::Iterator::Iterator(const uint64_t* words, size_t word_count, size_t word_index)
+    : words_(words), word_count_(word_count), word_index_(word_index),
+      current_(word_index < word_count ? words[word_index] : 0) {
+    SkipEmptyWords();
+}
+
+// Пропуск слов без установленных битов
+void SelectionBitmap::Iterator::SkipEmptyWords() {
+    while (current_ == 0 && word_index_ < word_count_) {
+        ++word_index_;
+        if (word_index_ < word_count_) {
+            current_ = words_[word_index_];
+        }
+    }
+}
+
+// Позиция текущего установленного бита
+size_t SelectionBitmap::Iterator::operator*() const {
+    return word_index_ * kWordBits + static_cast<size_t>(std::countr_zero(current_));
+}
+
+// Переход к следующему биту: младший установленный бит сбрасывается
+SelectionBitmap::Iterator& SelectionBitmap::Iterator::operator++() {
+    current_ &= current_ - 1;
+    SkipEmptyWords();
+    return *this;
+}
+
+SelectionBitmap::Iterator SelectionBitmap::Iterator::operator++(int) {
+    Iterator copy = *this;
+    ++*this;
+    return copy;
+}
+
+bool SelectionBitmap::Iterator::operator==(const Iterator& other) const {
+    return word_index_ == other.word_index_ && current_ == other.current_;
+}
+
+// Пустая маска
+SelectionBitmap::SelectionBitmap() : size_(0) {}
+
+// Маска из size сброшенных битов
+SelectionBitmap::SelectionBitmap(size_t size) : words_((size + kWordBits - 1) / kWordBits, 0), size_(size) {}
+
+// Число элементов, которые описывает маска
+size_t SelectionBitmap::Size() const {
+    return size_;
+}
+
+// Число установленных битов
+size_t SelectionBitmap::Count() const {
+    size_t count = 0;
+    for (uint64_t word : words_) {
+        count += static_cast<size_t>(std::popcount(word));
+    }
+    return count;
+}
+
+// Проверка бита
+bool SelectionBitmap::Test(size_t index) const {
+    return (words_[index / kWordBits] >> (index % kWordBits)) & 1;
+}
+
+// Установка бита
+void SelectionBitmap::Set(size_t index) {
+    words_[index / kWordBits] |= uint64_t{1} << (index % kWordBits);
+}
+
+uint64_t* SelectionBitmap::Words() {
+    return words_.data();
+}
+
+const uint64_t* SelectionBitmap::Words() const {
+    return words_.data();
+}
+
+size_t SelectionBitmap::WordCount() const {
+    return words_.size();
+}
+
+// Позиции установленных битов по возрастанию
+std::vector<size_t> SelectionBitmap::Indices() const {
+    std::vector<size_t> result;
+    result.reserve(Count());
+    for (size_t index : *this) {
+        result.push_back(index);
+    }
+    return result;
+}
+
+SelectionBitmap::Iterator SelectionBitmap::begin() const {
+    return Iterator(words_.data(), words_.size(), 0);
+}
+
+SelectionBitmap::Iterator SelectionBitmap::end() const {
+    return Iterator(words_.data(), words_.size(), words_.size());
+}
+
+// Пересечение выборок
+SelectionBitmap& SelectionBitmap::operator&=(const SelectionBitmap& other) {
+    if (size_ != other.size_) {
+        throw std::invalid_argument("SelectionBitmap sizes differ");
+    }
+    for (size_t i = 0; i < words_.size(); ++i) {
+        words_[i] &= other.words_[i];
+    }
+    return *this;
+}
+
+// Объединение выборок
+SelectionBitmap& SelectionBitmap::operator|=(const SelectionBitmap& other) {
+    if (size_ != other.size_) {
+        throw std::invalid_argument("SelectionBitmap sizes differ");
+    }
+    for (size_t i = 0; i < words_.size(); ++i) {
+        words_[i] |= other.words_[i];
+    }
+    return *this;
+}
+
+SelectionBitmap operator&(SelectionBitmap lhs, const SelectionBitmap& rhs) {
+    lhs &= rhs;
+    return lhs;
+}
+
+SelectionBitmap operator|(SelectionBitmap lhs, const SelectionBitmap& rhs) {
+    lhs |= rhs;
+    return lhs;
+}
+
+// Скалярное заполнение маски: бит собирается сдвигом без ветвлений
+template<typename Predicate>
+void FillBitmapScalar(const int* data, size_t size, Predicate& predicate, uint64_t* words) {
+    for (size_t base = 0; base < size; base += SelectionBitmap::kWordBits) {
+        size_t end = base + SelectionBitmap::kWordBits < size ? base + SelectionBitmap::kWordBits : size;
+        uint64_t word = 0;
+        for (size_t i = base; i < end; ++i) {
+            word |= static_cast<uint64_t>(static_cast<bool>(std::invoke(predicate, data[i]))) << (i - base);
+        }
+        words[base / SelectionBitmap::kWordBits] = word;
+    }
+}
+
+#if defined(__x86_64__) && defined(__GNUC__)
+// Проверка поддержки AVX2 процессором выполняется один раз
+bool CpuHasAvx2() {
+    static const bool has_avx2 = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return has_avx2;
+}
+
+// Ядро AVX2: восемь сравнений за раз, movemask дает 8 бит маски,
+// восемь таких порций составляют слово. Хвост короче слова - скалярно
+__attribute__((target("avx2")))
+void FillBitmapRangeAvx2(const int* data, size_t size, InRange range, uint64_t* words) {
+    const __m256i low = _mm256_set1_epi32(range.low);
+    const __m256i high = _mm256_set1_epi32(range.high);
+
+    size_t full_words = size / SelectionBitmap::kWordBits;
+    for (size_t w = 0; w < full_words; ++w) {
+        const int* block = data + w * SelectionBitmap::kWordBits;
+        uint64_t word = 0;
+        for (size_t k = 0; k < SelectionBitmap::kWordBits / 8; ++k) {
+            const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + k * 8));
+            const __m256i rejected = _mm256_or_si256(_mm256_cmpgt_epi32(low, values),
+                                                     _mm256_cmpgt_epi32(values, high));
+            const unsigned mask = ~static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(rejected))) & 0xFFu;
+            word |= static_cast<uint64_t>(mask) << (k * 8);
+        }
+        words[w] = word;
+    }
+
+    size_t tail = full_words * SelectionBitmap::kWordBits;
+    FillBitmapScalar(data + tail, size - tail, range, words + full_words);
+}
+#endif
+
+// Маска выбора по предикату. Предикаты сравнения (Less, Greater, InRange,
+// Equals) обрабатываются векторным ядром, остальные - скалярно.
+// Несколько условий объединяются операциями & и | над масками
+template<typename Predicate> requires std::predicate<Predicate&, int>
+SelectionBitmap FindAllBitmap(const std::vector<int>& vec, Predicate predicate) {
+    SelectionBitmap bitmap(vec.size());
+    if constexpr (std::is_pointer_v<Predicate>) {
+        if (!predicate) {
+            return bitmap;
+        }
+    }
+    if constexpr (ComparisonPredicate<Predicate>) {
+        InRange range = AsRange(predicate);
+#if defined(__x86_64__) && defined(__GNUC__)
+        if (CpuHasAvx2()) {
+            FillBitmapRangeAvx2(vec.data(), vec.size(), range, bitmap.Words());
+            return bitmap;
+        }
+#endif
+        FillBitmapScalar(vec.data(), vec.size(), range, bitmap.Words());
+    } else {
+        FillBitmapScalar(vec.data(), vec.size(), predicate, bitmap.Words());
+    }
+    return bitmap;
+}
+
+// Ленивый диапазон позиций: элементы проверяются по мере продвижения
+// итератора, результат не хранится. Вектор должен жить дольше диапазона
+template<typename Predicate>
+class MatchRange {
+public:
+    class Iterator {
+    private:
+        const MatchRange* range_;
+        size_t index_;
+
+        void SkipMismatches();
+
+    public:
+        using value_type = size_t;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator();
+        Iterator(const MatchRange* range, size_t index);
+
+        size_t operator*() const;
+        Iterator& operator++();
+        Iterator operator++(int);
+        bool operator==(const Iterator& other) const;
+    };
+
+private:
+    const int* data_;
+    size_t size_;
+    Predicate predicate_;
+
+public:
+    MatchRange(const std::vector<int>& vec, Predicate predicate);
+
+    Iterator begin() const;
+    Iterator end() const;
+};
+
+template<typename Predicate>
+MatchRange<Predicate>::Iterator::Iterator() : range_(nullptr), index_(0) {}
+
+// Итератор на первом подходящем элементе начиная с index
+template<typename Predicate>
+MatchRange<Predicate>::Iterator::Iterator(const MatchRange* range, size_t index) : range_(range), index_(index) {
+    SkipMismatches();
+}
+
+// Пропуск неподходящих элементов
+template<typename Predicate>
+void MatchRange<Predicate>::Iterator::SkipMismatches() {
+    while (index_ < range_->size_ && !std::invoke(range_->predicate_, range_->data_[index_])) {
+        ++index_;
+    }
+}
+
+template<typename Predicate>
+size_t MatchRange<Predicate>::Iterator::operator*() const {
+    return index_;
+}
+
+template<typename Predicate>
+typename MatchRange<Predicate>::Iterator& MatchRange<Predicate>::Iterator::operator++() {
+    ++index_;
+    SkipMismatches();
+    return *this;
+}
+
+template<typename Predicate>
+typename MatchRange<Predicate>::Iterator MatchRange<Predicate>::Iterator::operator++(int) {
+    Iterator copy = *this;
+    ++*this;
+    return copy;
+}
+
+template<typename Predicate>
+bool MatchRange<Predicate>::Iterator::operator==(const Iterator& other) const {
+    return index_ == other.index_;
+}
+
+// Нулевой указатель на функцию дает пустой диапазон
+template<typename Predicate>
+MatchRange<Predicate>::MatchRange(const std::vector<int>& vec, Predicate predicate)
+    : data_(vec.data()), size_(vec.size()), predicate_(std::move(predicate)) {
+    if constexpr (std::is_pointer_v<Predicate>) {
+        if (!predicate_) {
+            size_ = 0;
+        }
+    }
+}
+
+template<typename Predicate>
+typename MatchRange<Predicate>::Iterator MatchRange<Predicate>::begin() const {
+    return Iterator(this, 0);
+}
+
+template<typename Predicate>
+typename MatchRange<Predicate>::Iterator MatchRange<Predicate>::end() const {
+    return Iterator(this, size_);
+}
+
+// Ленивый поиск позиций: FindAllLazy(vec, AllOf(Greater{0}, Less{10}))
+// перебирает позиции без промежуточных векторов
+template<typename Predicate> requires std::predicate<const Predicate&, int>
+MatchRange<Predicate> FindAllLazy(const std::vector<int>& vec, Predicate predicate) {
+    return MatchRange<Predicate>(vec, std::move(predicate));
+}
+
+// Диапазон хранит ссылку на вектор: для временного вектора она повисла бы
+// сразу после вызова, поэтому такой вызов запрещен
+template<typename Predicate> requires std::predicate<const Predicate&, int>
+MatchRange<Predicate> FindAllLazy(const std::vector<int>&& vec, Predicate predicate) = delete;
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <random>
+#include <ranges>
+#include <stdexcept>
 #include <vector>
 
 #include "find_all.cpp"
@@ -116,4 +119,144 @@ TEST(FindAllTest, ConstCorrectness) {
     auto result = FindAll(vec, IsEven);
     std::vector<size_t> expected = {1, 3, 5, 7, 9};
     EXPECT_EQ(result, expected);
-}
\ No newline at end of file
+}
+
+std::vector<int> RandomVector(size_t size, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> value_dist(-1000, 1000);
+    std::vector<int> vec(size);
+    for (auto& value : vec) {
+        value = value_dist(gen);
+    }
+    return vec;
+}
+
+TEST(FindAllTest, ParallelSmallInput) {
+    std::vector<int> vec = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    EXPECT_EQ(FindAllParallel(vec, IsEven, 4), FindAll(vec, IsEven));
+    EXPECT_TRUE(FindAllParallel(std::vector<int>{}, IsEven).empty());
+}
+
+TEST(FindAllTest, ParallelNullptrPredicate) {
+    std::vector<int> vec(kMinParallelChunk * 4, 1);
+    bool (*predicate)(int) = nullptr;
+    EXPECT_TRUE(FindAllParallel(vec, predicate, 4).empty());
+}
+
+TEST(FindAllTest, ParallelMatchesSequential) {
+    auto vec = RandomVector(kMinParallelChunk * 8 + 123, 17);
+    auto expected = FindAll(vec, IsPositive);
+    for (size_t threads : {1u, 2u, 3u, 5u, 8u}) {
+        EXPECT_EQ(FindAllParallel(vec, IsPositive, threads), expected) << "threads = " << threads;
+    }
+    EXPECT_EQ(FindAllParallel(vec, [](int x) { return x > 0; }), expected);
+}
+
+TEST(FindAllTest, ParallelSkewedMatches) {
+    // Все совпадения в одном отрезке - смещения остальных частей нулевые
+    std::vector<int> vec(kMinParallelChunk * 4, 0);
+    for (size_t i = vec.size() / 2; i < vec.size() / 2 + 1000; ++i) {
+        vec[i] = 1;
+    }
+    auto result = FindAllParallel(vec, IsPositive, 4);
+    ASSERT_EQ(result.size(), 1000);
+    for (size_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(result[i], vec.size() / 2 + i);
+    }
+}
+
+TEST(FindAllTest, BitmapMatchesFindAll) {
+    // Размеры вокруг границ порции (8) и слова (64) проверяют обработку хвоста
+    for (size_t size : {0u, 1u, 7u, 8u, 63u, 64u, 65u, 130u, 1000u}) {
+        auto vec = RandomVector(size, static_cast<unsigned>(size));
+        auto bitmap = FindAllBitmap(vec, IsPositive);
+        EXPECT_EQ(bitmap.Size(), size);
+        EXPECT_EQ(bitmap.Indices(), FindAll(vec, IsPositive)) << "size = " << size;
+        EXPECT_EQ(FindAllBitmap(vec, Greater{0}).Indices(), bitmap.Indices()) << "size = " << size;
+    }
+}
+
+TEST(FindAllTest, BitmapComparisonPredicates) {
+    std::vector<int> vec = {5, -3, 8, 0, 12, 7, -1, 8, 3, 10, 8, -20};
+    EXPECT_EQ(FindAllBitmap(vec, Less{0}).Indices(), (std::vector<size_t>{1, 6, 11}));
+    EXPECT_EQ(FindAllBitmap(vec, Equals{8}).Indices(), (std::vector<size_t>{2, 7, 10}));
+    EXPECT_EQ(FindAllBitmap(vec, InRange{3, 7}).Indices(), (std::vector<size_t>{0, 5, 8}));
+
+    auto bitmap = FindAllBitmap(vec, Greater{7});
+    EXPECT_EQ(bitmap.Count(), 5);
+    EXPECT_TRUE(bitmap.Test(4));
+    EXPECT_FALSE(bitmap.Test(0));
+}
+
+TEST(FindAllTest, BitmapCombination) {
+    auto vec = RandomVector(1000, 3);
+    auto both = FindAllBitmap(vec, Greater{0}) & FindAllBitmap(vec, IsEven);
+    auto either = FindAllBitmap(vec, Less{-500}) | FindAllBitmap(vec, Greater{500});
+
+    EXPECT_EQ(both.Indices(), FindAll(vec, [](int x) { return x > 0 && x % 2 == 0; }));
+    auto lazy = FindAllLazy(vec, AnyOf(Less{-500}, Greater{500}));
+    EXPECT_EQ(either.Indices(), std::vector<size_t>(lazy.begin(), lazy.end()));
+}
+
+TEST(FindAllTest, BitmapSizeMismatch) {
+    std::vector<int> a(10, 1);
+    std::vector<int> b(11, 1);
+    auto bitmap = FindAllBitmap(a, IsPositive);
+    EXPECT_THROW(bitmap &= FindAllBitmap(b, IsPositive), std::invalid_argument);
+    EXPECT_THROW(bitmap |= FindAllBitmap(b, IsPositive), std::invalid_argument);
+}
+
+TEST(FindAllTest, BitmapIteration) {
+    std::vector<int> vec(200, 0);
+    vec[0] = vec[63] = vec[64] = vec[199] = 1;
+    std::vector<size_t> indices;
+    for (size_t index : FindAllBitmap(vec, IsPositive)) {
+        indices.push_back(index);
+    }
+    EXPECT_EQ(indices, (std::vector<size_t>{0, 63, 64, 199}));
+    EXPECT_TRUE(FindAllBitmap(std::vector<int>(100, 0), IsPositive).begin() ==
+                FindAllBitmap(std::vector<int>(100, 0), IsPositive).end());
+}
+
+TEST(FindAllTest, LazyRange) {
+    std::vector<int> vec = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    static_assert(std::ranges::forward_range<MatchRange<bool (*)(int)>>);
+
+    std::vector<size_t> indices;
+    for (size_t index : FindAllLazy(vec, IsEven)) {
+        indices.push_back(index);
+    }
+    EXPECT_EQ(indices, FindAll(vec, IsEven));
+
+    bool (*predicate)(int) = nullptr;
+    auto empty = FindAllLazy(vec, predicate);
+    EXPECT_TRUE(empty.begin() == empty.end());
+}
+
+// FindAllLazy принимает только вектор, который переживет диапазон
+template<typename Vector>
+concept LazyFindable = requires(Vector&& vec) { FindAllLazy(std::forward<Vector>(vec), IsEven); };
+
+TEST(FindAllTest, LazyRangeRejectsTemporaries) {
+    static_assert(LazyFindable<std::vector<int>&>);
+    static_assert(LazyFindable<const std::vector<int>&>);
+    static_assert(!LazyFindable<std::vector<int>>);
+    static_assert(!LazyFindable<const std::vector<int>>);
+}
+
+TEST(FindAllTest, LazyRangeEvaluatesOnDemand) {
+    std::vector<int> vec = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    size_t calls = 0;
+    auto range = FindAllLazy(vec, [&calls](int x) { ++calls; return x > 2; });
+    auto it = range.begin();
+    EXPECT_EQ(*it, 2);
+    EXPECT_EQ(calls, 3);
+}
+
+TEST(FindAllTest, LazyRangeCombinators) {
+    auto vec = RandomVector(1000, 5);
+    auto in_range = FindAllLazy(vec, AllOf(Greater{0}, Less{100}, IsEven));
+    std::vector<size_t> indices(in_range.begin(), in_range.end());
+    EXPECT_EQ(indices, FindAll(vec, [](int x) { return x > 0 && x < 100 && x % 2 == 0; }));
+    EXPECT_EQ(FindAllBitmap(vec, AllOf(Greater{0}, Less{100}, IsEven)).Indices(), indices);
+}
@@ -0,0 +1,86 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "minmax.cpp"
+
+// Время выполнения body в наносекундах на один из elements элементов
+template<typename Body>
+double NanosecondsPerElement(size_t elements, Body body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(finish - start).count() / static_cast<double>(elements);
+}
+
+// Исходный общий цикл MinMax: три сравнения с ветвлениями на элемент
+template<typename T>
+__attribute__((noinline)) MinMaxIndex BaselineMinMax(const T* data, size_t size) {
+    size_t begin = 0;
+    while (begin < size && IsNan(data[begin])) {
+        ++begin;
+    }
+    if (begin == size) {
+        return {};
+    }
+    size_t min_index = begin;
+    size_t max_index = begin;
+    for (size_t i = begin + 1; i < size; ++i) {
+        if (IsNan(data[i])) {
+        } else if (data[i] < data[min_index]) {
+            min_index = i;
+        } else if (data[i] > data[max_index]) {
+            max_index = i;
+        } else if (data[i] == data[max_index]) {
+            max_index = i;
+        }
+    }
+    return {min_index, max_index};
+}
+
+template<typename T>
+__attribute__((noinline)) MinMaxIndex ScalarMinMax(const T* data, size_t size) {
+    return MinMaxLanes(data, size);
+}
+
+template<typename T>
+__attribute__((noinline)) MinMaxIndex DispatchMinMax(const T* data, size_t size) {
+    return MinMaxContiguous(data, size);
+}
+
+// Одна строка таблицы: исходный цикл, скалярное ядро с дорожками и
+// MinMaxContiguous (ядро AVX2 для int, float и double)
+template<typename T>
+void BenchmarkType(const char* name, size_t size) {
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+    std::vector<T> vec(size);
+    for (auto& value : vec) {
+        value = static_cast<T>(dist(gen));
+    }
+
+    auto run = [&](auto kernel) {
+        MinMaxIndex result;
+        double ns = NanosecondsPerElement(size, [&] { result = kernel(vec.data(), size); });
+        asm volatile("" : : "r"(result.min), "r"(result.max) : "memory");
+        return ns;
+    };
+    double baseline_ns = run(BaselineMinMax<T>);
+    double lanes_ns = run(ScalarMinMax<T>);
+    double dispatch_ns = run(DispatchMinMax<T>);
+    std::printf("%8s %12.3f %12.3f %12.3f\n", name, baseline_ns, lanes_ns, dispatch_ns);
+}
+
+// Аргумент - число элементов
+int main(int argc, char** argv) {
+    size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+
+    std::printf("MinMax of %zu elements, ns/element\n", size);
+    std::printf("%8s %12s %12s %12s\n", "type", "baseline", "lanes", "MinMax");
+    BenchmarkType<int>("int", size);
+    BenchmarkType<float>("float", size);
+    BenchmarkType<double>("double", size);
+    return 0;
+}
@@ -1,6 +1,298 @@
 #include <vector>
 #include <utility>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <type_traits>
 
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#endif
+
+
+// NaN не упорядочен ни с одним значением, поэтому в поиске не участвует.
+// Для не-float типов всегда false
+template<typename T>
+constexpr bool IsNan(const T& value) {
+    if constexpr (std::floating_point<T>) {
+        return value != value;
+    } else {
+        return false;
+    }
+}
+
+// Непрерывный диапазон арифметического типа - для него есть быстрый путь
+template<typename Iterator>
+concept ContiguousArithmeticIterator = std::contiguous_iterator<Iterator> &&
+                                       std::is_arithmetic_v<std::iter_value_t<Iterator>>;
+
+// Позиции минимума и максимума в непрерывном диапазоне.
+// kNoIndex - в диапазоне нет ни одного упорядоченного (не NaN) элемента
+constexpr size_t kNoIndex = std::numeric_limits<size_t>::max();
+
+struct MinMaxIndex {
+    size_t min = kNoIndex;
+    size_t max = kNoIndex;
+};
+
+// Объединение двух частичных результатов с сохранением правил: при равенстве
+// значений минимум - меньшая позиция, максимум - большая. Части могут
+// чередоваться (дорожки), поэтому порядок решается по позициям
+template<typename T>
+MinMaxIndex MergeMinMax(const T* data, MinMaxIndex lhs, MinMaxIndex rhs) {
+    MinMaxIndex result = lhs;
+    if (rhs.min != kNoIndex &&
+        (lhs.min == kNoIndex || data[rhs.min] < data[lhs.min] ||
+         (!(data[lhs.min] < data[rhs.min]) && rhs.min < lhs.min))) {
+        result.min = rhs.min;
+    }
+    if (rhs.max != kNoIndex &&
+        (lhs.max == kNoIndex || data[lhs.max] < data[rhs.max] ||
+         (!(data[rhs.max] < data[lhs.max]) && rhs.max > lhs.max))) {
+        result.max = rhs.max;
+    }
+    return result;
+}
+
+// Число независимых дорожек в скалярном ядре
+constexpr size_t kMinMaxLanes = 8;
+
+// Скалярное ядро: kMinMaxLanes независимых минимумов и максимумов убирают
+// зависимость по данным между соседними элементами, затем дорожки
+// объединяются. Хвост короче блока дописывается по порядку
+template<typename T>
+MinMaxIndex MinMaxLanes(const T* data, size_t size) {
+    T low[kMinMaxLanes] = {};
+    T high[kMinMaxLanes] = {};
+    size_t min_index[kMinMaxLanes];
+    size_t max_index[kMinMaxLanes];
+    for (size_t j = 0; j < kMinMaxLanes; ++j) {
+        min_index[j] = kNoIndex;
+        max_index[j] = kNoIndex;
+    }
+
+    size_t blocks = size / kMinMaxLanes;
+    for (size_t b = 0; b < blocks; ++b) {
+        const T* block = data + b * kMinMaxLanes;
+        for (size_t j = 0; j < kMinMaxLanes; ++j) {
+            const T x = block[j];
+            if (IsNan(x)) {
+                continue;
+            }
+            const size_t i = b * kMinMaxLanes + j;
+            // Строгое < оставляет первое вхождение минимума, нестрогое -
+            // последнее вхождение максимума
+            if (min_index[j] == kNoIndex || x < low[j]) {
+                low[j] = x;
+                min_index[j] = i;
+            }
+            if (max_index[j] == kNoIndex || !(x < high[j])) {
+                high[j] = x;
+                max_index[j] = i;
+            }
+        }
+    }
+
+    MinMaxIndex result;
+    for (size_t j = 0; j < kMinMaxLanes; ++j) {
+        result = MergeMinMax(data, result, MinMaxIndex{min_index[j], max_index[j]});
+    }
+    for (size_t i = blocks * kMinMaxLanes; i < size; ++i) {
+        if (!IsNan(data[i])) {
+            result = MergeMinMax(data, result, MinMaxIndex{i, i});
+        }
+    }
+    return result;
+}
+
+#if defined(__x86_64__) && defined(__GNUC__)
+// Проверка поддержки AVX2 процессором выполняется один раз
+bool CpuHasAvx2() {
+    static const bool has_avx2 = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return has_avx2;
+}
+
+// Позиции в ядре AVX2 хранятся в 32-битных дорожках, поэтому длинный
+// диапазон обрабатывается частями не длиннее kMinMaxAvx2Chunk
+constexpr size_t kMinMaxAvx2Chunk = size_t{1} << 30;
+
+// Ядро AVX2 для int: восемь дорожек значений (min/max) и восемь дорожек
+// позиций, которые обновляются смешиванием по маске сравнения.
+// Требует size >= 8 и size <= kMinMaxAvx2Chunk
+__attribute__((target("avx2")))
+MinMaxIndex MinMaxIntAvx2(const int* data, size_t size) {
+    const __m256i step = _mm256_set1_epi32(8);
+    const __m256i all_ones = _mm256_set1_epi32(-1);
+    __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    __m256i high = low;
+    __m256i min_index = index;
+    __m256i max_index = index;
+
+    size_t i = 8;
+    for (; i + 8 <= size; i += 8) {
+        index = _mm256_add_epi32(index, step);
+        const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        // Строго меньше - первое вхождение, не меньше - последнее
+        const __m256i less = _mm256_cmpgt_epi32(low, values);
+        const __m256i not_less = _mm256_xor_si256(_mm256_cmpgt_epi32(high, values), all_ones);
+        low = _mm256_min_epi32(low, values);
+        high = _mm256_max_epi32(high, values);
+        min_index = _mm256_blendv_epi8(min_index, index, less);
+        max_index = _mm256_blendv_epi8(max_index, index, not_less);
+    }
+
+    alignas(32) int32_t min_lanes[8];
+    alignas(32) int32_t max_lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(min_lanes), min_index);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(max_lanes), max_index);
+
+    MinMaxIndex result;
+    for (size_t j = 0; j < 8; ++j) {
+        result = MergeMinMax(data, result, MinMaxIndex{static_cast<size_t>(min_lanes[j]),
+                                                       static_cast<size_t>(max_lanes[j])});
+    }
+    for (; i < size; ++i) {
+        result = MergeMinMax(data, result, MinMaxIndex{i, i});
+    }
+    return result;
+}
+
+// Ядра AVX2 для float и double. Дорожки значений начинаются с NaN - пустая
+// дорожка. Элемент x обновляет минимум дорожки, если он упорядочен и
+// !(low <= x) (_CMP_NLE_UQ: истинно и для пустой дорожки), максимум - если
+// упорядочен и !(x < high) (_CMP_NLT_UQ). NaN во входе маска упорядоченности
+// (_CMP_ORD_Q) отбрасывает, поэтому он никогда не попадает в дорожку.
+// Позиции смешиваются по тем же маскам, как в MinMaxIntAvx2; позиция -1 -
+// в дорожке не было ни одного упорядоченного элемента.
+// Для float позиции 32-битные: size <= kMinMaxAvx2Chunk
+__attribute__((target("avx2")))
+MinMaxIndex MinMaxFloatAvx2(const float* data, size_t size) {
+    const __m256i step = _mm256_set1_epi32(8);
+    __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256 low = _mm256_set1_ps(std::numeric_limits<float>::quiet_NaN());
+    __m256 high = low;
+    __m256i min_index = _mm256_set1_epi32(-1);
+    __m256i max_index = min_index;
+
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m256 values = _mm256_loadu_ps(data + i);
+        const __m256 ordered = _mm256_cmp_ps(values, values, _CMP_ORD_Q);
+        const __m256 less = _mm256_and_ps(_mm256_cmp_ps(low, values, _CMP_NLE_UQ), ordered);
+        const __m256 not_less = _mm256_and_ps(_mm256_cmp_ps(values, high, _CMP_NLT_UQ), ordered);
+        low = _mm256_blendv_ps(low, values, less);
+        high = _mm256_blendv_ps(high, values, not_less);
+        min_index = _mm256_blendv_epi8(min_index, index, _mm256_castps_si256(less));
+        max_index = _mm256_blendv_epi8(max_index, index, _mm256_castps_si256(not_less));
+        index = _mm256_add_epi32(index, step);
+    }
+
+    alignas(32) int32_t min_lanes[8];
+    alignas(32) int32_t max_lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(min_lanes), min_index);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(max_lanes), max_index);
+
+    MinMaxIndex result;
+    for (size_t j = 0; j < 8; ++j) {
+        if (min_lanes[j] >= 0) {
+            result = MergeMinMax(data, result, MinMaxIndex{static_cast<size_t>(min_lanes[j]),
+                                                           static_cast<size_t>(max_lanes[j])});
+        }
+    }
+    for (; i < size; ++i) {
+        if (!IsNan(data[i])) {
+            result = MergeMinMax(data, result, MinMaxIndex{i, i});
+        }
+    }
+    return result;
+}
+
+// То же для double: четыре дорожки, позиции 64-битные
+__attribute__((target("avx2")))
+MinMaxIndex MinMaxDoubleAvx2(const double* data, size_t size) {
+    const __m256i step = _mm256_set1_epi64x(4);
+    __m256i index = _mm256_setr_epi64x(0, 1, 2, 3);
+    __m256d low = _mm256_set1_pd(std::numeric_limits<double>::quiet_NaN());
+    __m256d high = low;
+    __m256i min_index = _mm256_set1_epi64x(-1);
+    __m256i max_index = min_index;
+
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const __m256d values = _mm256_loadu_pd(data + i);
+        const __m256d ordered = _mm256_cmp_pd(values, values, _CMP_ORD_Q);
+        const __m256d less = _mm256_and_pd(_mm256_cmp_pd(low, values, _CMP_NLE_UQ), ordered);
+        const __m256d not_less = _mm256_and_pd(_mm256_cmp_pd(values, high, _CMP_NLT_UQ), ordered);
+        low = _mm256_blendv_pd(low, values, less);
+        high = _mm256_blendv_pd(high, values, not_less);
+        min_index = _mm256_blendv_epi8(min_index, index, _mm256_castpd_si256(less));
+        max_index = _mm256_blendv_epi8(max_index, index, _mm256_castpd_si256(not_less));
+        index = _mm256_add_epi64(index, step);
+    }
+
+    alignas(32) int64_t min_lanes[4];
+    alignas(32) int64_t max_lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(min_lanes), min_index);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(max_lanes), max_index);
+
+    MinMaxIndex result;
+    for (size_t j = 0; j < 4; ++j) {
+        if (min_lanes[j] >= 0) {
+            result = MergeMinMax(data, result, MinMaxIndex{static_cast<size_t>(min_lanes[j]),
+                                                           static_cast<size_t>(max_lanes[j])});
+        }
+    }
+    for (; i < size; ++i) {
+        if (!IsNan(data[i])) {
+            result = MergeMinMax(data, result, MinMaxIndex{i, i});
+        }
+    }
+    return result;
+}
+#endif
+
+// Поиск в непрерывном диапазоне: для int, float и double - ядра AVX2 (если
+// процессор их поддерживает), для остальных арифметических типов - скалярное ядро.
+// Ядра с 32-битными позициями получают части не длиннее kMinMaxAvx2Chunk
+template<typename T>
+MinMaxIndex MinMaxContiguous(const T* data, size_t size) {
+#if defined(__x86_64__) && defined(__GNUC__)
+    if constexpr (std::same_as<T, int> || std::same_as<T, float>) {
+        if (size >= 8 && CpuHasAvx2()) {
+            MinMaxIndex result;
+            for (size_t offset = 0; offset < size; offset += kMinMaxAvx2Chunk) {
+                size_t count = size - offset < kMinMaxAvx2Chunk ? size - offset : kMinMaxAvx2Chunk;
+                MinMaxIndex part;
+                if (count < 8) {
+                    part = MinMaxLanes(data + offset, count);
+                } else if constexpr (std::same_as<T, int>) {
+                    part = MinMaxIntAvx2(data + offset, count);
+                } else {
+                    part = MinMaxFloatAvx2(data + offset, count);
+                }
+                if (part.min != kNoIndex) {
+                    part.min += offset;
+                    part.max += offset;
+                }
+                result = MergeMinMax(data, result, part);
+            }
+            return result;
+        }
+    } else if constexpr (std::same_as<T, double>) {
+        if (size >= 4 && CpuHasAvx2()) {
+            return MinMaxDoubleAvx2(data, size);
+        }
+    }
+#endif
+    return MinMaxLanes(data, size);
+}
 
 /*Находит минимальный и максимальный элементы в векторе целых 
 чисел за один проход. 
@@ -9,11 +301,28 @@
 1 указывает на первое вхождение минимального элемента,
 2 указывает на последнее вхождение максимального элемента. 
 
-Для пустого вектора возвращает пару итераторов end()*/
+Для пустого вектора возвращает пару итераторов end().
+
+Для чисел с плавающей точкой NaN пропускаются; если упорядоченных
+элементов нет, также возвращается пара end()*/
 
 template<typename Iterator>
 std::pair<Iterator, Iterator> MinMax(Iterator begin, Iterator end) {
 
+    // Непрерывный диапазон чисел - векторный путь по позициям
+    if constexpr (ContiguousArithmeticIterator<Iterator>) {
+        MinMaxIndex index = MinMaxContiguous(std::to_address(begin), static_cast<size_t>(end - begin));
+        if (index.min == kNoIndex) {
+            return {end, end};
+        }
+        return {begin + index.min, begin + index.max};
+    }
+
+    // Пропуск NaN в начале
+    while (begin != end && IsNan(*begin)) {
+        ++begin;
+    }
+
     // Проверка на вектор нулевой длины
     if (begin == end) {
         return {end, end};
@@ -27,7 +336,10 @@ std::pair<Iterator, Iterator> MinMax(Iterator begin, Iterator end) {
     
     while (current != end) {
         
-        if (*current < *min_it) {
+        if (IsNan(*current)) {
+            // NaN не сравнивается ни с чем
+        }
+        else if (*current < *min_it) {
             min_it = current;
         }
         else if (*current > *max_it) {
@@ -54,4 +366,53 @@ MinMax(const std::vector<int>& vec) {
 std::pair<std::vector<int>::iterator, std::vector<int>::iterator> 
 MinMax(std::vector<int>& vec) {
     return MinMax(vec.begin(), vec.end());
-}
\ No newline at end of file
+}
+
+// Меньше этого числа элементов на поток распараллеливание не окупается
+constexpr size_t kMinParallelChunk = 1 << 16;
+
+// Параллельный поиск для непрерывных диапазонов чисел: каждый поток ищет в
+// своем непрерывном отрезке, частичные результаты объединяются с теми же
+// правилами выбора вхождений, поэтому ответ совпадает с MinMax.
+// 0 потоков - по числу ядер
+template<ContiguousArithmeticIterator Iterator>
+std::pair<Iterator, Iterator> MinMaxParallel(Iterator begin, Iterator end, size_t threads = 0) {
+    const size_t size = static_cast<size_t>(end - begin);
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    size_t max_threads = size / kMinParallelChunk;
+    if (threads > max_threads) {
+        threads = max_threads;
+    }
+    if (threads <= 1) {
+        return MinMax(begin, end);
+    }
+
+    const auto* data = std::to_address(begin);
+    std::vector<MinMaxIndex> partial(threads);
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (size_t t = 0; t < threads; ++t) {
+        size_t chunk_begin = size * t / threads;
+        size_t chunk_end = size * (t + 1) / threads;
+        workers.emplace_back([data, &partial, t, chunk_begin, chunk_end] {
+            MinMaxIndex part = MinMaxContiguous(data + chunk_begin, chunk_end - chunk_begin);
+            if (part.min != kNoIndex) {
+                part.min += chunk_begin;
+                part.max += chunk_begin;
+            }
+            partial[t] = part;
+        });
+    }
+
+    MinMaxIndex result;
+    for (size_t t = 0; t < threads; ++t) {
+        workers[t].join();
+        result = MergeMinMax(data, result, partial[t]);
+    }
+    if (result.min == kNoIndex) {
+        return {end, end};
+    }
+    return {begin + result.min, begin + result.max};
+}
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <limits>
+#include <list>
 #include <numeric>
 #include <random>
 #include <vector>
@@ -134,8 +136,121 @@ TEST(MinMaxTest, PerformanceCheck) {
     end = std::chrono::high_resolution_clock::now();
     auto duration_std = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
 
-    EXPECT_LE(std::abs(duration_std.count() - duration.count()) * 1.0, duration_std.count() * THRESHOLD) <<
+    EXPECT_LE(duration.count() * 1.0, duration_std.count() * (1.0 + THRESHOLD)) <<
         "Your function is very slowly";
     EXPECT_EQ(*min_it, *min_it_std);
     EXPECT_EQ(*max_it, *max_it_std);
-}
\ No newline at end of file
+}
+
+TEST(MinMaxTest, TieBreakingAcrossLanes) {
+    // Повторы минимума и максимума попадают в разные дорожки и части
+    for (size_t size : {1u, 7u, 8u, 9u, 16u, 17u, 100u, 1001u}) {
+        std::vector<int> vec(size, 0);
+        for (size_t i = 0; i < size; i += 3) {
+            vec[i] = -5;
+        }
+        for (size_t i = 1; i < size; i += 5) {
+            vec[i] = 5;
+        }
+        auto [min_it, max_it] = MinMax(vec);
+
+        size_t first_min = 0;
+        size_t last_max = 0;
+        for (size_t i = 0; i < size; ++i) {
+            if (vec[i] < vec[first_min]) {
+                first_min = i;
+            }
+            if (vec[i] >= vec[last_max]) {
+                last_max = i;
+            }
+        }
+        EXPECT_EQ(min_it - vec.begin(), first_min) << "size = " << size;
+        EXPECT_EQ(max_it - vec.begin(), last_max) << "size = " << size;
+    }
+}
+
+TEST(MinMaxTest, ArithmeticTypes) {
+    std::vector<double> doubles = {2.5, -1.0, 7.0, -1.0, 7.0, 0.0, 3.0, 1.0, 2.0, -0.5};
+    auto [dmin, dmax] = MinMax(doubles.begin(), doubles.end());
+    EXPECT_EQ(dmin - doubles.begin(), 1);
+    EXPECT_EQ(dmax - doubles.begin(), 4);
+
+    std::vector<unsigned char> bytes = {9, 200, 3, 3, 200, 17, 0, 255, 0, 255, 1};
+    auto [bmin, bmax] = MinMax(bytes.begin(), bytes.end());
+    EXPECT_EQ(bmin - bytes.begin(), 6);
+    EXPECT_EQ(bmax - bytes.begin(), 9);
+}
+
+TEST(MinMaxTest, NanIsSkipped) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> vec = {nan, 3.0, nan, -2.0, 8.0, nan, 8.0, -2.0, nan, 1.0};
+    auto [min_it, max_it] = MinMax(vec.begin(), vec.end());
+    EXPECT_EQ(min_it - vec.begin(), 3);
+    EXPECT_EQ(max_it - vec.begin(), 6);
+
+    // Тот же результат на итераторах списка
+    std::list<double> list(vec.begin(), vec.end());
+    auto [list_min, list_max] = MinMax(list.begin(), list.end());
+    EXPECT_EQ(std::distance(list.begin(), list_min), 3);
+    EXPECT_EQ(std::distance(list.begin(), list_max), 6);
+
+    std::vector<double> only_nan(20, nan);
+    auto [nan_min, nan_max] = MinMax(only_nan.begin(), only_nan.end());
+    EXPECT_EQ(nan_min, only_nan.end());
+    EXPECT_EQ(nan_max, only_nan.end());
+}
+
+// Ядра для float и double сравниваются с общим циклом по итераторам списка:
+// NaN, бесконечности, нули разных знаков и повторы в разных дорожках
+template<typename T>
+void CheckFloatingMatchesList(unsigned seed) {
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+    const T inf = std::numeric_limits<T>::infinity();
+    const T pool[] = {nan, inf, -inf, T(0), -T(0), T(1.5), T(-1.5), T(7), T(-7)};
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<size_t> pick(0, std::size(pool) - 1);
+    for (size_t size : {1u, 3u, 4u, 5u, 7u, 8u, 9u, 15u, 16u, 17u, 33u, 100u, 1001u}) {
+        for (int round = 0; round < 20; ++round) {
+            std::vector<T> vec(size);
+            for (auto& value : vec) {
+                value = pool[pick(gen)];
+            }
+            std::list<T> list(vec.begin(), vec.end());
+            auto [list_min, list_max] = MinMax(list.begin(), list.end());
+            auto [min_it, max_it] = MinMax(vec.begin(), vec.end());
+            ASSERT_EQ(min_it - vec.begin(), std::distance(list.begin(), list_min)) << "size = " << size;
+            ASSERT_EQ(max_it - vec.begin(), std::distance(list.begin(), list_max)) << "size = " << size;
+        }
+    }
+}
+
+TEST(MinMaxTest, FloatingKernelsMatchGenericLoop) {
+    CheckFloatingMatchesList<float>(3);
+    CheckFloatingMatchesList<double>(4);
+}
+
+TEST(MinMaxTest, ParallelMatchesSequential) {
+    std::vector<int> vec(kMinParallelChunk * 8 + 5);
+    std::mt19937 gen(3);
+    std::uniform_int_distribution<int> dist(-1000, 1000);
+    for (auto& value : vec) {
+        value = dist(gen);
+    }
+
+    auto expected = MinMax(vec);
+    for (size_t threads : {0u, 1u, 2u, 3u, 8u}) {
+        auto [min_it, max_it] = MinMaxParallel(vec.begin(), vec.end(), threads);
+        EXPECT_EQ(min_it, expected.first) << "threads = " << threads;
+        EXPECT_EQ(max_it, expected.second) << "threads = " << threads;
+    }
+
+    std::vector<float> floats(kMinParallelChunk * 4, std::numeric_limits<float>::quiet_NaN());
+    auto [nan_min, nan_max] = MinMaxParallel(floats.begin(), floats.end(), 4);
+    EXPECT_EQ(nan_min, floats.end());
+    EXPECT_EQ(nan_max, floats.end());
+    floats[10] = 1.0f;
+    floats[floats.size() - 10] = 1.0f;
+    auto [one_min, one_max] = MinMaxParallel(floats.begin(), floats.end(), 4);
+    EXPECT_EQ(one_min - floats.begin(), 10);
+    EXPECT_EQ(one_max - floats.begin(), floats.size() - 10);
+}
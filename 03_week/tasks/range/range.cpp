@@ -1,50 +1,246 @@
 #include <vector>
 #include <stdexcept>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
 
-/*Генерирует последовательность целых чисел в указанном диапазоне.*/
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#endif
 
-std::vector<int> Range(int from, int to, int step) {
-    // Обработка некорректных параметров
-    if (step == 0) {
-        return std::vector<int>(); //пустой вектор
-    }
-    
-    // Если шаг положительный, но from >= to - диапазон пуст
-    if (step > 0 && from >= to) {
-        return std::vector<int>();
+// Ленивый диапазон [from, to) с шагом step. Хранит только начало, шаг и
+// число элементов; элемент вычисляется по индексу, поэтому размер и доступ
+// по индексу - O(1), а память под элементы не выделяется.
+// Итераторы не ссылаются на диапазон и остаются валидными после его удаления
+class RangeView : public std::ranges::view_interface<RangeView> {
+public:
+    class Iterator {
+    private:
+        int from_;
+        int step_;
+        std::ptrdiff_t index_;
+
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+
+        constexpr Iterator();
+        constexpr Iterator(int from, int step, std::ptrdiff_t index);
+
+        constexpr int operator*() const;
+        constexpr int operator[](difference_type n) const;
+
+        constexpr Iterator& operator++();
+        constexpr Iterator operator++(int);
+        constexpr Iterator& operator--();
+        constexpr Iterator operator--(int);
+        constexpr Iterator& operator+=(difference_type n);
+        constexpr Iterator& operator-=(difference_type n);
+
+        constexpr Iterator operator+(difference_type n) const;
+        constexpr Iterator operator-(difference_type n) const;
+        constexpr difference_type operator-(const Iterator& other) const;
+
+        constexpr bool operator==(const Iterator& other) const;
+        constexpr std::strong_ordering operator<=>(const Iterator& other) const;
+    };
+
+private:
+    int from_;
+    int step_;
+    size_t size_;
+
+public:
+    constexpr RangeView();
+    constexpr RangeView(int from, int to, int step = 1);
+
+    constexpr Iterator begin() const;
+    constexpr Iterator end() const;
+    constexpr size_t size() const;
+    constexpr int operator[](size_t index) const;
+};
+
+// Значение элемента с номером index. Все элементы лежат между from и to,
+// поэтому результат помещается в int; промежуточный расчет - в int64_t
+constexpr int RangeElement(int from, int step, std::ptrdiff_t index) {
+    return static_cast<int>(static_cast<int64_t>(from) + static_cast<int64_t>(step) * index);
+}
+
+// Итератор по умолчанию
+constexpr RangeView::Iterator::Iterator() : from_(0), step_(0), index_(0) {}
+
+// Итератор на элемент с номером index
+constexpr RangeView::Iterator::Iterator(int from, int step, std::ptrdiff_t index)
+    : from_(from), step_(step), index_(index) {}
+
+constexpr int RangeView::Iterator::operator*() const {
+    return RangeElement(from_, step_, index_);
+}
+
+constexpr int RangeView::Iterator::operator[](difference_type n) const {
+    return RangeElement(from_, step_, index_ + n);
+}
+
+constexpr RangeView::Iterator& RangeView::Iterator::operator++() {
+    ++index_;
+    return *this;
+}
+
+constexpr RangeView::Iterator RangeView::Iterator::operator++(int) {
+    Iterator copy = *this;
+    ++index_;
+    return copy;
+}
+
+constexpr RangeView::Iterator& RangeView::Iterator::operator--() {
+    --index_;
+    return *this;
+}
+
+constexpr RangeView::Iterator RangeView::Iterator::operator--(int) {
+    Iterator copy = *this;
+    --index_;
+    return copy;
+}
+
+constexpr RangeView::Iterator& RangeView::Iterator::operator+=(difference_type n) {
+    index_ += n;
+    return *this;
+}
+
+constexpr RangeView::Iterator& RangeView::Iterator::operator-=(difference_type n) {
+    index_ -= n;
+    return *this;
+}
+
+constexpr RangeView::Iterator RangeView::Iterator::operator+(difference_type n) const {
+    return Iterator(from_, step_, index_ + n);
+}
+
+constexpr RangeView::Iterator RangeView::Iterator::operator-(difference_type n) const {
+    return Iterator(from_, step_, index_ - n);
+}
+
+constexpr RangeView::Iterator::difference_type RangeView::Iterator::operator-(const Iterator& other) const {
+    return index_ - other.index_;
+}
+
+// Итераторы одного диапазона сравниваются по номеру элемента
+constexpr bool RangeView::Iterator::operator==(const Iterator& other) const {
+    return index_ == other.index_;
+}
+
+constexpr std::strong_ordering RangeView::Iterator::operator<=>(const Iterator& other) const {
+    return index_ <=> other.index_;
+}
+
+// n + it для произвольного доступа
+constexpr RangeView::Iterator operator+(RangeView::Iterator::difference_type n, const RangeView::Iterator& it) {
+    return it + n;
+}
+
+// Пустой диапазон
+constexpr RangeView::RangeView() : from_(0), step_(1), size_(0) {}
+
+// Число элементов считается в int64_t: to - from и step - 1 не переполняются
+// даже на границах int. Некорректные параметры (нулевой шаг, шаг не в сторону
+// to) дают пустой диапазон, как у Range
+constexpr RangeView::RangeView(int from, int to, int step) : from_(from), step_(step), size_(0) {
+    const int64_t distance = static_cast<int64_t>(to) - from;
+    if (step > 0 && distance > 0) {
+        size_ = static_cast<size_t>((distance + step - 1) / step);
+    } else if (step < 0 && distance < 0) {
+        size_ = static_cast<size_t>((-distance - static_cast<int64_t>(step) - 1) / -static_cast<int64_t>(step));
     }
-    
-    // Если шаг отрицательный, но from <= to - диапазон пуст
-    if (step < 0 && from <= to) {
-        return std::vector<int>();
+}
+
+constexpr RangeView::Iterator RangeView::begin() const {
+    return Iterator(from_, step_, 0);
+}
+
+constexpr RangeView::Iterator RangeView::end() const {
+    return Iterator(from_, step_, static_cast<std::ptrdiff_t>(size_));
+}
+
+constexpr size_t RangeView::size() const {
+    return size_;
+}
+
+constexpr int RangeView::operator[](size_t index) const {
+    return RangeElement(from_, step_, static_cast<std::ptrdiff_t>(index));
+}
+
+// Итераторы не ссылаются на диапазон - его можно передавать во view по значению
+template<>
+inline constexpr bool std::ranges::enable_borrowed_range<RangeView> = true;
+
+#if defined(__x86_64__) && defined(__GNUC__)
+// Проверка поддержки AVX2 процессором выполняется один раз
+bool CpuHasAvx2() {
+    static const bool has_avx2 = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return has_avx2;
+}
+
+// Векторный iota: регистр {from, from + step, ..., from + 7 * step}
+// на каждом шаге сдвигается на 8 * step. Арифметика по модулю 2^32
+// совпадает с точной, пока значения помещаются в int
+__attribute__((target("avx2")))
+void FillRangeAvx2(int* out, size_t count, int from, int step) {
+    const uint32_t ustep = static_cast<uint32_t>(step);
+    __m256i values = _mm256_add_epi32(_mm256_set1_epi32(from),
+                                      _mm256_mullo_epi32(_mm256_set1_epi32(step),
+                                                         _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)));
+    const __m256i increment = _mm256_set1_epi32(static_cast<int>(ustep * 8u));
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), values);
+        values = _mm256_add_epi32(values, increment);
     }
-    
-    // Вычисляем количество элементов заранее, 
-    // чтобы сразу выделить необходимую память 
-
-    int count = 0;
-    
-    if (step > 0) { // для возрастающего диапазона
-        count = (to - from + step - 1) / step;
-    } else {        // для убывающего диапазона
-        count = (to - from + step + 1) / step;
+    for (; i < count; ++i) {
+        out[i] = static_cast<int>(static_cast<uint32_t>(from) + ustep * static_cast<uint32_t>(i));
     }
-    
-    // Создаем вектор с нужной емкостью
-    std::vector<int> result;
-    result.reserve(count); // выделили память под count элементов
-    
-    // Заполняем вектор значениями
-    if (step > 0) {
-        for (int i = from; i < to; i += step) {
-            result.push_back(i);
-        }
-    } else {
-        for (int i = from; i > to; i += step) {
-            result.push_back(i);
+}
+#endif
+
+// Запись арифметической прогрессии from, from + step, ... в память вызывающего
+// (out.size() элементов). При вычислении на этапе компиляции - простой цикл,
+// во время выполнения - векторное ядро, если процессор его поддерживает
+constexpr void FillRange(std::span<int> out, int from, int step) {
+    if (!std::is_constant_evaluated()) {
+#if defined(__x86_64__) && defined(__GNUC__)
+        if (CpuHasAvx2()) {
+            FillRangeAvx2(out.data(), out.size(), from, step);
+            return;
         }
+#endif
+    }
+    const uint32_t ustep = static_cast<uint32_t>(step);
+    for (size_t i = 0; i < out.size(); ++i) {
+        out[i] = static_cast<int>(static_cast<uint32_t>(from) + ustep * static_cast<uint32_t>(i));
     }
-    
+}
+
+/*Генерирует последовательность целых чисел в указанном диапазоне.*/
+
+std::vector<int> Range(int from, int to, int step) {
+    // Число элементов считается заранее (без переполнения на границах int),
+    // чтобы сразу выделить необходимую память; некорректные параметры
+    // дают пустой вектор
+    std::vector<int> result(RangeView(from, to, step).size());
+
+    // Заполняем вектор значениями
+    FillRange(result, from, step);
+
     return result;
 }
 
@@ -52,4 +248,4 @@ std::vector<int> Range(int from, int to, int step) {
 //Функция с шагом по умолчанию (step = 1)
 std::vector<int> Range(int from, int to) {
     return Range(from, to, 1);
-}
\ No newline at end of file
+}
@@ -2,6 +2,10 @@
 
 #include <vector>
 #include <algorithm>
+#include <array>
+#include <limits>
+#include <ranges>
+#include <span>
 
 #include "range.cpp"
 
@@ -95,4 +99,99 @@ TEST(RangePerformanceTest, LargeRange) {
 
     EXPECT_GE(result_asc.capacity(), result_asc.size());
     EXPECT_GE(result_desc.capacity(), result_desc.size());
-}
\ No newline at end of file
+}
+
+TEST(RangeViewTest, MatchesRange) {
+    const int params[][3] = {{1, 6, 1}, {1, 7, 2}, {-20, 10, 10}, {6, 1, -1}, {7, 1, -2}, {20, 18, -3},
+                             {0, 0, 2}, {1, 7, -1}, {3, 7, 0}, {0, 100, 33}, {100, 0, -33}, {-7, -8, -100}};
+    for (const auto& p : params) {
+        RangeView view(p[0], p[1], p[2]);
+        std::vector<int> expected = Range(p[0], p[1], p[2]);
+        EXPECT_EQ(std::vector<int>(view.begin(), view.end()), expected)
+            << "Range(" << p[0] << ", " << p[1] << ", " << p[2] << ")";
+        ASSERT_EQ(view.size(), expected.size());
+        for (size_t i = 0; i < view.size(); ++i) {
+            EXPECT_EQ(view[i], expected[i]);
+        }
+    }
+}
+
+TEST(RangeViewTest, RangeFor) {
+    std::vector<int> values;
+    for (int value : RangeView(0, 5)) {
+        values.push_back(value);
+    }
+    EXPECT_EQ(values, std::vector<int>({0, 1, 2, 3, 4}));
+}
+
+TEST(RangeViewTest, Constexpr) {
+    constexpr RangeView view(10, 0, -3);
+    static_assert(view.size() == 4);
+    static_assert(view[3] == 1);
+    static_assert(*(view.begin() + 2) == 4);
+    static_assert(view.end() - view.begin() == 4);
+
+    constexpr auto sum = [] {
+        int total = 0;
+        for (int value : RangeView(1, 101)) {
+            total += value;
+        }
+        return total;
+    }();
+    static_assert(sum == 5050);
+
+    constexpr auto filled = [] {
+        std::array<int, 5> out{};
+        FillRange(out, 7, -2);
+        return out;
+    }();
+    static_assert(filled == std::array<int, 5>{7, 5, 3, 1, -1});
+}
+
+TEST(RangeViewTest, RangesCompatibility) {
+    static_assert(std::ranges::random_access_range<RangeView>);
+    static_assert(std::ranges::sized_range<RangeView>);
+    static_assert(std::ranges::view<RangeView>);
+    static_assert(std::ranges::borrowed_range<RangeView>);
+
+    auto squares = RangeView(0, 10) | std::views::filter([](int x) { return x % 2 == 0; })
+                                    | std::views::transform([](int x) { return x * x; });
+    EXPECT_EQ(std::vector<int>(squares.begin(), squares.end()), std::vector<int>({0, 4, 16, 36, 64}));
+
+    auto reversed = RangeView(0, 5) | std::views::reverse;
+    EXPECT_EQ(std::vector<int>(reversed.begin(), reversed.end()), std::vector<int>({4, 3, 2, 1, 0}));
+
+    EXPECT_EQ(std::ranges::distance(RangeView(0, 1000, 7)), 143);
+    EXPECT_EQ(RangeView(0, 1000, 7).back(), 994);
+    EXPECT_TRUE(RangeView(5, 5).empty());
+}
+
+TEST(RangeViewTest, ExtremeBounds) {
+    const int min = std::numeric_limits<int>::min();
+    const int max = std::numeric_limits<int>::max();
+
+    RangeView all(min, max);
+    EXPECT_EQ(all.size(), static_cast<size_t>(max) - min);
+    EXPECT_EQ(all[0], min);
+    EXPECT_EQ(all[all.size() - 1], max - 1);
+
+    RangeView wide(max, min, min);
+    EXPECT_EQ(std::vector<int>(wide.begin(), wide.end()), std::vector<int>({max, -1}));
+
+    EXPECT_EQ(Range(max - 2, max), std::vector<int>({max - 2, max - 1}));
+    EXPECT_EQ(Range(min + 2, min, -1), std::vector<int>({min + 2, min + 1}));
+}
+
+TEST(RangeViewTest, FillRange) {
+    // Размеры вокруг ширины регистра проверяют обработку хвоста
+    for (size_t count : {0u, 1u, 7u, 8u, 9u, 17u, 1000u}) {
+        for (int step : {1, -3, 1000}) {
+            std::vector<int> out(count + 1, 42);
+            FillRange(std::span<int>(out.data(), count), -50, step);
+            for (size_t i = 0; i < count; ++i) {
+                EXPECT_EQ(out[i], -50 + step * static_cast<int>(i)) << "count = " << count << ", step = " << step;
+            }
+            EXPECT_EQ(out[count], 42) << "write past the end";
+        }
+    }
+}
@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "unique.cpp"
+
+// Время выполнения body в наносекундах на один из elements элементов
+template<typename Body>
+double NanosecondsPerElement(size_t elements, Body body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(finish - start).count() / static_cast<double>(elements);
+}
+
+// Отсортированный вектор из size значений, выбранных из distinct различных
+std::vector<int> SortedWithDuplicates(size_t size, int distinct, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, distinct - 1);
+    std::vector<int> vec(size);
+    for (auto& value : vec) {
+        value = dist(gen);
+    }
+    std::sort(vec.begin(), vec.end());
+    return vec;
+}
+
+// Unique, UniqueInPlace и std::unique при разной доле повторов.
+// Копирующему Unique соответствует копия + std::unique + shrink_to_fit
+// (столбец "std copy"), функциям на месте - std::unique на месте.
+// Копия исходных данных для функций на месте делается вне замера
+void BenchmarkDuplicateRatios(size_t size) {
+    std::printf("Unique of %zu sorted ints, ns/element\n", size);
+    std::printf("%12s %10s %12s %12s %12s %12s\n", "distinct", "kept", "Unique", "std copy", "InPlace",
+                "std::unique");
+
+    std::vector<int> vec;
+    for (int distinct : {10, 1000, 1'000'000, 1'000'000'000}) {
+        const auto source = SortedWithDuplicates(size, distinct, 5);
+
+        std::vector<int> result;
+        double copy_ns = NanosecondsPerElement(size, [&] { result = Unique(source); });
+        asm volatile("" : : "r"(result.data()) : "memory");
+        const size_t kept = result.size();
+
+        result = std::vector<int>();
+        double std_copy_ns = NanosecondsPerElement(size, [&] {
+            result = source;
+            result.erase(std::unique(result.begin(), result.end()), result.end());
+            result.shrink_to_fit();
+        });
+        asm volatile("" : : "r"(result.data()) : "memory");
+
+        vec = source;
+        double in_place_ns = NanosecondsPerElement(size, [&] { UniqueInPlace(vec); });
+        asm volatile("" : : "r"(vec.data()) : "memory");
+
+        vec = source;
+        double std_ns = NanosecondsPerElement(size, [&] { vec.erase(std::unique(vec.begin(), vec.end()), vec.end()); });
+        asm volatile("" : : "r"(vec.data()) : "memory");
+
+        std::printf("%12d %9.1f%% %12.3f %12.3f %12.3f %12.3f\n", distinct,
+                    100.0 * static_cast<double>(kept) / static_cast<double>(size), copy_ns, std_copy_ns,
+                    in_place_ns, std_ns);
+    }
+}
+
+// Аргумент - число элементов
+int main(int argc, char** argv) {
+    size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+
+    BenchmarkDuplicateRatios(size);
+    return 0;
+}
@@ -3,6 +3,10 @@
 #include <vector>
 #include <random>
 #include <algorithm>
+#include <chrono>
+#include <limits>
+#include <unordered_map>
+#include <utility>
 
 #include "unique.cpp"
 
@@ -89,4 +93,210 @@ TEST(UniqueTest, ConstCorrectness) {
     auto result = Unique(vec);
     std::vector<int> expected = {1, 2, 3};
     EXPECT_EQ(result, expected);
-}
\ No newline at end of file
+}
+
+std::vector<int> SortedWithDuplicates(size_t size, int distinct, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, distinct - 1);
+    std::vector<int> vec(size);
+    for (auto& value : vec) {
+        value = dist(gen);
+    }
+    std::sort(vec.begin(), vec.end());
+    return vec;
+}
+
+std::vector<int> StdUnique(std::vector<int> vec) {
+    vec.erase(std::unique(vec.begin(), vec.end()), vec.end());
+    return vec;
+}
+
+TEST(UniqueTest, InPlace) {
+    std::vector<int> vec = {-3, -3, 0, 1, 1, 1, 2, 5, 5, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10};
+    auto capacity = vec.capacity();
+    auto ptr_before = vec.data();
+    UniqueInPlace(vec);
+    EXPECT_EQ(vec, (std::vector<int>{-3, 0, 1, 2, 5, 9, 10}));
+    EXPECT_EQ(vec.data(), ptr_before);
+    EXPECT_EQ(vec.capacity(), capacity);
+
+    std::vector<int> empty;
+    UniqueInPlace(empty);
+    EXPECT_TRUE(empty.empty());
+}
+
+TEST(UniqueTest, DuplicateRatios) {
+    // Доля повторов от почти нулевой до почти полной; размеры вокруг ширины
+    // регистра проверяют обработку хвоста
+    for (int distinct : {1, 2, 10, 1000, 100'000, 10'000'000}) {
+        for (size_t size : {1u, 8u, 9u, 17u, 100'003u}) {
+            auto vec = SortedWithDuplicates(size, distinct, static_cast<unsigned>(size) + distinct);
+            auto expected = StdUnique(vec);
+
+            auto result = Unique(vec);
+            EXPECT_EQ(result, expected) << "distinct = " << distinct << ", size = " << size;
+            EXPECT_EQ(result.capacity(), result.size());
+
+            UniqueInPlace(vec);
+            EXPECT_EQ(vec, expected) << "distinct = " << distinct << ", size = " << size;
+        }
+    }
+}
+
+TEST(UniqueTest, ParallelMatchesSequential) {
+    for (int distinct : {1, 3, 1000, 10'000'000}) {
+        auto source = SortedWithDuplicates(kMinParallelChunk * 8 + 7, distinct, static_cast<unsigned>(distinct));
+        auto expected = StdUnique(source);
+        for (size_t threads : {1u, 2u, 3u, 8u}) {
+            auto vec = source;
+            auto ptr_before = vec.data();
+            UniqueParallel(vec, threads);
+            EXPECT_EQ(vec, expected) << "distinct = " << distinct << ", threads = " << threads;
+            EXPECT_EQ(vec.data(), ptr_before);
+        }
+    }
+}
+
+TEST(UniqueTest, ParallelDuplicatesAcrossBoundaries) {
+    // Один длинный повтор пересекает все границы отрезков
+    std::vector<int> vec(kMinParallelChunk * 4, 7);
+    vec.front() = 1;
+    vec.back() = 9;
+    UniqueParallel(vec, 4);
+    EXPECT_EQ(vec, (std::vector<int>{1, 7, 9}));
+}
+
+TEST(UniqueTest, PerformanceAtDuplicateRatios) {
+#if defined(__SANITIZE_THREAD__)
+    // Под TSan время выполнения не показательно
+    GTEST_SKIP() << "timing test is meaningless under ThreadSanitizer";
+#endif
+    const size_t SIZE = 1'000'000;
+    const size_t NUM_TESTS = 3;
+    for (int distinct : {10, 1'000'000, 1'000'000'000}) {
+        const auto source = SortedWithDuplicates(SIZE, distinct, 5);
+
+        // Лучшее из нескольких повторов; копии для функций на месте делаются
+        // вне замера. Копирующий Unique сравнивается с копией + std::unique +
+        // shrink_to_fit - так же получается новый вектор с точной вместимостью
+        long long duration_std = std::numeric_limits<long long>::max();
+        long long duration = std::numeric_limits<long long>::max();
+        long long duration_std_copy = std::numeric_limits<long long>::max();
+        long long duration_copy = std::numeric_limits<long long>::max();
+        for (size_t test_idx = 0; test_idx < NUM_TESTS; ++test_idx) {
+            auto expected = source;
+            auto start = std::chrono::high_resolution_clock::now();
+            expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+            auto end = std::chrono::high_resolution_clock::now();
+            duration_std = std::min<long long>(
+                duration_std, std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+
+            auto vec = source;
+            start = std::chrono::high_resolution_clock::now();
+            UniqueInPlace(vec);
+            end = std::chrono::high_resolution_clock::now();
+            duration = std::min<long long>(
+                duration, std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+
+            ASSERT_EQ(vec, expected);
+
+            start = std::chrono::high_resolution_clock::now();
+            std::vector<int> std_copy = source;
+            std_copy.erase(std::unique(std_copy.begin(), std_copy.end()), std_copy.end());
+            std_copy.shrink_to_fit();
+            end = std::chrono::high_resolution_clock::now();
+            duration_std_copy = std::min<long long>(
+                duration_std_copy, std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+
+            start = std::chrono::high_resolution_clock::now();
+            auto copy = Unique(source);
+            end = std::chrono::high_resolution_clock::now();
+            duration_copy = std::min<long long>(
+                duration_copy, std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+
+            ASSERT_EQ(copy, expected);
+        }
+
+        // Запас 10% на шум таймера
+        EXPECT_LE(duration, duration_std * 1.1)
+            << "distinct = " << distinct << ": in-place Unique " << duration
+            << " us, std::unique " << duration_std << " us";
+        EXPECT_LE(duration_copy, duration_std_copy * 1.1)
+            << "distinct = " << distinct << ": Unique " << duration_copy
+            << " us, copy + std::unique " << duration_std_copy << " us";
+    }
+}
+
+// Эталон: уникальные значения и частоты в порядке первого появления
+std::vector<std::pair<int, size_t>> ReferenceCounts(const std::vector<int>& vec) {
+    std::unordered_map<int, size_t> index;
+    std::vector<std::pair<int, size_t>> result;
+    for (int value : vec) {
+        auto [it, inserted] = index.emplace(value, result.size());
+        if (inserted) {
+            result.emplace_back(value, 0);
+        }
+        ++result[it->second].second;
+    }
+    return result;
+}
+
+std::vector<int> RandomUnsorted(size_t size, int distinct, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(-distinct / 2, distinct - distinct / 2 - 1);
+    std::vector<int> vec(size);
+    for (auto& value : vec) {
+        value = dist(gen);
+    }
+    return vec;
+}
+
+TEST(UniqueTest, UnsortedFirstOccurrenceOrder) {
+    std::vector<int> vec = {5, 3, 5, 1, 3, 3, 9, 1, 0, 5};
+    auto result = UniqueUnsorted(vec);
+    EXPECT_EQ(result, (std::vector<int>{5, 3, 1, 9, 0}));
+    EXPECT_EQ(result.capacity(), result.size());
+    EXPECT_TRUE(UniqueUnsorted(std::vector<int>{}).empty());
+}
+
+TEST(UniqueTest, UnsortedExtremeValues) {
+    // INT_MIN служит меткой пустого слота и хранится отдельно
+    const int min = std::numeric_limits<int>::min();
+    const int max = std::numeric_limits<int>::max();
+    std::vector<int> vec = {0, min, max, min, 0, -1, max, min};
+    EXPECT_EQ(UniqueUnsorted(vec), (std::vector<int>{0, min, max, -1}));
+    auto counts = UniqueCounts(vec);
+    EXPECT_EQ(counts, (std::vector<std::pair<int, size_t>>{{0, 2}, {min, 3}, {max, 2}, {-1, 1}}));
+}
+
+TEST(UniqueTest, UnsortedMatchesReference) {
+    // От почти одних повторов до почти одних уникальных - таблица растет
+    for (int distinct : {1, 16, 1000, 1'000'000, 2'000'000'000}) {
+        auto vec = RandomUnsorted(200'000, distinct, static_cast<unsigned>(distinct));
+        auto expected = ReferenceCounts(vec);
+        auto counts = UniqueCounts(vec);
+        EXPECT_EQ(counts, expected) << "distinct = " << distinct;
+        EXPECT_EQ(counts.capacity(), counts.size());
+
+        auto unique = UniqueUnsorted(vec);
+        ASSERT_EQ(unique.size(), expected.size());
+        EXPECT_EQ(unique.capacity(), unique.size());
+        for (size_t i = 0; i < unique.size(); ++i) {
+            EXPECT_EQ(unique[i], expected[i].first);
+        }
+    }
+}
+
+TEST(UniqueTest, UnsortedParallelMatchesSequential) {
+    for (int distinct : {1, 100, 2'000'000'000}) {
+        auto vec = RandomUnsorted(kMinParallelChunk * 6 + 11, distinct, 3);
+        vec[vec.size() / 2] = std::numeric_limits<int>::min();
+        auto expected = UniqueCounts(vec);
+        for (size_t threads : {1u, 2u, 3u, 6u}) {
+            EXPECT_EQ(UniqueCountsParallel(vec, threads), expected)
+                << "distinct = " << distinct << ", threads = " << threads;
+        }
+        auto unique = UniqueUnsortedParallel(vec, 4);
+        EXPECT_EQ(unique, UniqueUnsorted(vec)) << "distinct = " << distinct;
+    }
+}
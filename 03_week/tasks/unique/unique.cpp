@@ -1,25 +1,569 @@
 #include <vector>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <utility>
 
-/*Возвращает вектор уникальных элементов из исходного отсортированного вектора*/
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#endif
+
+// Меньше этого числа элементов на поток распараллеливание не окупается
+constexpr size_t kMinParallelChunk = 1 << 16;
+
+// Число потоков для size элементов: 0 - по числу ядер, но не больше,
+// чем позволяет kMinParallelChunk
+size_t ParallelThreads(size_t size, size_t threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    size_t max_threads = size / kMinParallelChunk;
+    return threads < max_threads ? threads : max_threads;
+}
+
+// Число элементов отсортированного отрезка, отличных от предыдущего.
+// Первый элемент сравнивается с *prev, а при prev == nullptr учитывается всегда
+size_t CountUniqueScalar(const int* data, size_t size, const int* prev) {
+    if (size == 0) {
+        return 0;
+    }
+    size_t count = (prev == nullptr || data[0] != *prev) ? 1 : 0;
+    for (size_t i = 1; i < size; ++i) {
+        count += data[i] != data[i - 1];
+    }
+    return count;
+}
+
+// Запись элементов, отличных от предыдущего, начиная с out (out может
+// совпадать с data - сжатие на месте). Первый элемент сравнивается с *prev,
+// при prev == nullptr остается всегда. Возвращает число записанных
+size_t UniqueCompactScalar(const int* data, size_t size, int* out, const int* prev) {
+    if (size == 0) {
+        return 0;
+    }
+    size_t write_index = 0;
+    int last = data[0];
+    if (prev == nullptr || data[0] != *prev) {
+        out[write_index++] = data[0];
+    }
+    for (size_t i = 1; i < size; ++i) {
+        const int value = data[i];
+        if (value != last) {
+            out[write_index++] = value;
+        }
+        last = value;
+    }
+    return write_index;
+}
+
+#if defined(__x86_64__) && defined(__GNUC__)
+// Таблица перестановок: для каждой 8-битной маски - номера выбранных дорожек,
+// прижатые к началу регистра (хвост заполняется чем угодно)
+constexpr std::array<std::array<int32_t, 8>, 256> MakeCompactionTable() {
+    std::array<std::array<int32_t, 8>, 256> table{};
+    for (size_t mask = 0; mask < 256; ++mask) {
+        size_t lane = 0;
+        for (int32_t bit = 0; bit < 8; ++bit) {
+            if (mask & (size_t{1} << bit)) {
+                table[mask][lane++] = bit;
+            }
+        }
+    }
+    return table;
+}
+
+inline constexpr std::array<std::array<int32_t, 8>, 256> kCompactionTable = MakeCompactionTable();
+
+// Проверка поддержки AVX2 процессором выполняется один раз
+bool CpuHasAvx2() {
+    static const bool has_avx2 = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return has_avx2;
+}
+
+// Подсчет AVX2: блок сравнивается с тем же блоком, сдвинутым на один элемент
+// назад (невыровненная загрузка с data + i - 1)
+__attribute__((target("avx2,popcnt")))
+size_t CountUniqueAvx2(const int* data, size_t size, const int* prev) {
+    if (size == 0) {
+        return 0;
+    }
+    size_t count = (prev == nullptr || data[0] != *prev) ? 1 : 0;
+    size_t i = 1;
+    for (; i + 8 <= size; i += 8) {
+        const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const __m256i previous = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i - 1));
+        const unsigned equal = static_cast<unsigned>(
+            _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(values, previous))));
+        count += 8 - static_cast<size_t>(__builtin_popcount(equal));
+    }
+    for (; i < size; ++i) {
+        count += data[i] != data[i - 1];
+    }
+    return count;
+}
+
+// Сжатие AVX2. При работе на месте запись может затереть предыдущий элемент
+// следующего блока, поэтому сдвинутый блок собирается в регистре: поворот
+// дорожек на одну и последний элемент прошлого блока в нулевой дорожке.
+// Маска различий выбирает перестановку из kCompactionTable.
+// Восемь дорожек пишутся прямо в out, пока они помещаются в out_size; ближе
+// к концу out (Unique выделяет ровно столько, сколько уникальных) блок
+// пишется в буфер на стеке, и в out копируются только выбранные элементы
+__attribute__((target("avx2,popcnt")))
+size_t UniqueCompactAvx2(const int* data, size_t size, int* out, size_t out_size, const int* prev) {
+    if (size == 0) {
+        return 0;
+    }
+    size_t write_index = 0;
+    int last = data[0];
+    if (prev == nullptr || data[0] != *prev) {
+        out[write_index++] = data[0];
+    }
+
+    const __m256i rotate = _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6);
+    size_t i = 1;
+    alignas(32) int block[8];
+    for (; i + 8 <= size; i += 8) {
+        const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const __m256i previous = _mm256_blend_epi32(_mm256_permutevar8x32_epi32(values, rotate),
+                                                    _mm256_set1_epi32(last), 0x01);
+        const unsigned mask = ~static_cast<unsigned>(_mm256_movemask_ps(
+            _mm256_castsi256_ps(_mm256_cmpeq_epi32(values, previous)))) & 0xFFu;
+        last = _mm256_extract_epi32(values, 7);
+        const __m256i permutation = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(kCompactionTable[mask].data()));
+        const __m256i selected = _mm256_permutevar8x32_epi32(values, permutation);
+        const size_t count = static_cast<size_t>(__builtin_popcount(mask));
+        if (write_index + 8 <= out_size) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + write_index), selected);
+        } else {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(block), selected);
+            std::memcpy(out + write_index, block, count * sizeof(int));
+        }
+        write_index += count;
+    }
+
+    // Хвост: элементы до i уже учтены, last - последний из них
+    for (; i < size; ++i) {
+        const int value = data[i];
+        if (value != last) {
+            out[write_index++] = value;
+        }
+        last = value;
+    }
+    return write_index;
+}
+#endif
+
+// Подсчет уникальных: векторное ядро, если процессор его поддерживает
+size_t CountUnique(const int* data, size_t size, const int* prev) {
+#if defined(__x86_64__) && defined(__GNUC__)
+    if (CpuHasAvx2()) {
+        return CountUniqueAvx2(data, size, prev);
+    }
+#endif
+    return CountUniqueScalar(data, size, prev);
+}
+
+// Сжатие уникальных в out вместимостью out_size
+size_t UniqueCompact(const int* data, size_t size, int* out, size_t out_size, const int* prev) {
+#if defined(__x86_64__) && defined(__GNUC__)
+    if (CpuHasAvx2()) {
+        return UniqueCompactAvx2(data, size, out, out_size, prev);
+    }
+#endif
+    (void)out_size;
+    return UniqueCompactScalar(data, size, out, prev);
+}
+
+/*Возвращает вектор уникальных элементов из исходного отсортированного вектора.
+Сначала считается число уникальных элементов, поэтому память выделяется
+ровно один раз и вместимость сразу равна размеру*/
 
 std::vector<int> Unique(const std::vector<int>& sorted_vec) {
     if (sorted_vec.empty()) {
         return std::vector<int>();
     }
-    
-    std::vector<int> result;
-    result.reserve(sorted_vec.size()); // резервируем максимально возможный размер
-    
-    result.push_back(sorted_vec[0]);
-    
-    for (size_t i = 1; i < sorted_vec.size(); ++i) {
-        if (sorted_vec[i] != sorted_vec[i - 1]) {
-            result.push_back(sorted_vec[i]);
-        }
-    }
-    
-    // Устанавливаем емкость, равную размеру
-    result.shrink_to_fit();
-    
+
+    std::vector<int> result(CountUnique(sorted_vec.data(), sorted_vec.size(), nullptr));
+    UniqueCompact(sorted_vec.data(), sorted_vec.size(), result.data(), result.size(), nullptr);
+    return result;
+}
+
+// Удаление повторов на месте: без выделения памяти, вместимость сохраняется
+void UniqueInPlace(std::vector<int>& sorted_vec) {
+    sorted_vec.resize(UniqueCompact(sorted_vec.data(), sorted_vec.size(),
+                                    sorted_vec.data(), sorted_vec.size(), nullptr));
+}
+
+// Параллельное удаление повторов на месте. Каждый поток сжимает свой
+// непрерывный отрезок; первый элемент отрезка сравнивается с последним
+// элементом предыдущего отрезка, который запоминается до запуска потоков -
+// иначе его могло бы затереть сжатие соседа. Затем отрезки по порядку
+// сдвигаются к своим смещениям, как в FilterParallel. 0 потоков - по числу ядер
+void UniqueParallel(std::vector<int>& sorted_vec, size_t threads = 0) {
+    threads = ParallelThreads(sorted_vec.size(), threads);
+    if (threads <= 1) {
+        UniqueInPlace(sorted_vec);
+        return;
+    }
+
+    // Граничные элементы: последний элемент каждого предыдущего отрезка
+    std::vector<int> boundary(threads);
+    for (size_t t = 1; t < threads; ++t) {
+        boundary[t] = sorted_vec[sorted_vec.size() * t / threads - 1];
+    }
+
+    std::vector<size_t> counts(threads);
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (size_t t = 0; t < threads; ++t) {
+        size_t begin = sorted_vec.size() * t / threads;
+        size_t end = sorted_vec.size() * (t + 1) / threads;
+        workers.emplace_back([&sorted_vec, &boundary, &counts, t, begin, end] {
+            int* data = sorted_vec.data() + begin;
+            counts[t] = UniqueCompact(data, end - begin, data, end - begin, t == 0 ? nullptr : &boundary[t]);
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    size_t offset = 0;
+    for (size_t t = 0; t < threads; ++t) {
+        size_t begin = sorted_vec.size() * t / threads;
+        if (offset != begin && counts[t] != 0) {
+            std::memmove(sorted_vec.data() + offset, sorted_vec.data() + begin, counts[t] * sizeof(int));
+        }
+        offset += counts[t];
+    }
+    sorted_vec.resize(offset);
+}
+
+// Хеш-таблица с открытой адресацией для неотсортированных данных:
+// значение -> номер значения в порядке первого появления.
+// Слоты сгруппированы в корзины по kBucketSlots; корзина проверяется одним
+// векторным сравнением (SSE2), при заполненной корзине поиск идет в следующей.
+// Удалений нет, поэтому свободные слоты корзины всегда в ее конце.
+// Пустой слот помечается kEmptyKey; само это значение хранится отдельно
+class FirstOccurrenceMap {
+public:
+    static constexpr size_t kBucketSlots = 8;
+    static constexpr int kEmptyKey = std::numeric_limits<int>::min();
+    static constexpr size_t kNoIndex = std::numeric_limits<size_t>::max();
+
+private:
+    std::vector<int> keys_;
+    std::vector<size_t> indices_;
+    size_t bucket_shift_;
+    size_t stored_;
+    size_t size_;
+    size_t empty_key_index_;
+
+    size_t BucketOf(int value) const;
+    size_t BucketCount() const;
+    void Place(int value, size_t index);
+    void Grow();
+
+public:
+    explicit FirstOccurrenceMap(size_t expected_size = 0);
+
+    // Номер значения и признак того, что оно встретилось впервые
+    std::pair<size_t, bool> Insert(int value);
+    size_t Size() const;
+    // Различные значения в порядке их номеров, вместимость равна размеру
+    std::vector<int> Keys() const;
+};
+
+// Маска слотов корзины, равных key: бит j - слот j
+unsigned BucketMatchMask(const int* slots, int key) {
+#if defined(__x86_64__) && defined(__GNUC__)
+    const __m128i needle = _mm_set1_epi32(key);
+    const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(slots));
+    const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(slots + 4));
+    return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(low, needle)))) |
+           static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(high, needle)))) << 4;
+#else
+    unsigned mask = 0;
+    for (size_t j = 0; j < FirstOccurrenceMap::kBucketSlots; ++j) {
+        mask |= static_cast<unsigned>(slots[j] == key) << j;
+    }
+    return mask;
+#endif
+}
+
+// Таблица на expected_size значений без перестроений (не меньше двух корзин)
+FirstOccurrenceMap::FirstOccurrenceMap(size_t expected_size)
+    : bucket_shift_(63), stored_(0), size_(0), empty_key_index_(kNoIndex) {
+    size_t buckets = 2;
+    while (buckets * kBucketSlots * 7 < expected_size * 8) {
+        buckets *= 2;
+        --bucket_shift_;
+    }
+    keys_.assign(buckets * kBucketSlots, kEmptyKey);
+    indices_.resize(buckets * kBucketSlots);
+}
+
+// Мультипликативное (фибоначчиево) хеширование: старшие биты произведения
+size_t FirstOccurrenceMap::BucketOf(int value) const {
+    return static_cast<size_t>((static_cast<uint64_t>(static_cast<uint32_t>(value)) * 0x9E3779B97F4A7C15ull)
+                               >> bucket_shift_);
+}
+
+size_t FirstOccurrenceMap::BucketCount() const {
+    return keys_.size() / kBucketSlots;
+}
+
+// Вставка заведомо нового значения (при перестроении)
+void FirstOccurrenceMap::Place(int value, size_t index) {
+    size_t bucket = BucketOf(value);
+    while (true) {
+        const unsigned empty = BucketMatchMask(keys_.data() + bucket * kBucketSlots, kEmptyKey);
+        if (empty != 0) {
+            size_t slot = bucket * kBucketSlots + static_cast<size_t>(std::countr_zero(empty));
+            keys_[slot] = value;
+            indices_[slot] = index;
+            return;
+        }
+        bucket = (bucket + 1) & (BucketCount() - 1);
+    }
+}
+
+// Удвоение числа корзин
+void FirstOccurrenceMap::Grow() {
+    std::vector<int> old_keys = std::move(keys_);
+    std::vector<size_t> old_indices = std::move(indices_);
+    keys_.assign(old_keys.size() * 2, kEmptyKey);
+    indices_.assign(old_indices.size() * 2, 0);
+    --bucket_shift_;
+    for (size_t slot = 0; slot < old_keys.size(); ++slot) {
+        if (old_keys[slot] != kEmptyKey) {
+            Place(old_keys[slot], old_indices[slot]);
+        }
+    }
+}
+
+std::pair<size_t, bool> FirstOccurrenceMap::Insert(int value) {
+    if (value == kEmptyKey) {
+        if (empty_key_index_ == kNoIndex) {
+            empty_key_index_ = size_++;
+            return {empty_key_index_, true};
+        }
+        return {empty_key_index_, false};
+    }
+
+    size_t bucket = BucketOf(value);
+    while (true) {
+        const int* slots = keys_.data() + bucket * kBucketSlots;
+        const unsigned found = BucketMatchMask(slots, value);
+        if (found != 0) {
+            return {indices_[bucket * kBucketSlots + static_cast<size_t>(std::countr_zero(found))], false};
+        }
+        const unsigned empty = BucketMatchMask(slots, kEmptyKey);
+        if (empty != 0) {
+            // Заполненность не выше 7/8, иначе цепочки корзин становятся длинными
+            if ((stored_ + 1) * 8 > keys_.size() * 7) {
+                Grow();
+                Place(value, size_);
+            } else {
+                size_t slot = bucket * kBucketSlots + static_cast<size_t>(std::countr_zero(empty));
+                keys_[slot] = value;
+                indices_[slot] = size_;
+            }
+            ++stored_;
+            return {size_++, true};
+        }
+        bucket = (bucket + 1) & (BucketCount() - 1);
+    }
+}
+
+// Число различных значений
+size_t FirstOccurrenceMap::Size() const {
+    return size_;
+}
+
+// Каждое значение записывается на место своего номера - обход слотов таблицы
+std::vector<int> FirstOccurrenceMap::Keys() const {
+    std::vector<int> keys(size_);
+    for (size_t slot = 0; slot < keys_.size(); ++slot) {
+        if (keys_[slot] != kEmptyKey) {
+            keys[indices_[slot]] = keys_[slot];
+        }
+    }
+    if (empty_key_index_ != kNoIndex) {
+        keys[empty_key_index_] = kEmptyKey;
+    }
+    return keys;
+}
+
+/*Возвращает уникальные элементы неотсортированного вектора в порядке их
+первого появления - без сортировки, за один проход с хеш-таблицей.
+Результат собирается из таблицы, когда число значений уже известно, поэтому
+память под него выделяется один раз, как у Unique*/
+
+std::vector<int> UniqueUnsorted(const std::vector<int>& vec) {
+    FirstOccurrenceMap seen;
+    for (int value : vec) {
+        seen.Insert(value);
+    }
+    return seen.Keys();
+}
+
+// Пары значение/частота в порядке первого появления значения. Частоты
+// копятся по номерам значений, ответ выделяется один раз в конце
+std::vector<std::pair<int, size_t>> UniqueCounts(const std::vector<int>& vec) {
+    FirstOccurrenceMap seen;
+    std::vector<size_t> counts;
+    for (int value : vec) {
+        auto [index, inserted] = seen.Insert(value);
+        if (inserted) {
+            counts.push_back(0);
+        }
+        ++counts[index];
+    }
+
+    std::vector<int> keys = seen.Keys();
+    std::vector<std::pair<int, size_t>> result(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        result[i] = {keys[i], counts[i]};
+    }
+    return result;
+}
+
+// Запуск task(t) для t = 0..threads-1 в отдельных потоках и ожидание всех
+template<typename Task>
+void RunThreads(size_t threads, Task task) {
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&task, t] { task(t); });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+// Номер раздела для значения: второй хеш, независимый от хеша корзин,
+// отображается на [0, partitions) умножением без деления
+size_t PartitionOf(int value, size_t partitions) {
+    const uint64_t hash = (static_cast<uint64_t>(static_cast<uint32_t>(value)) * 0xD6E8FEB86659FD93ull) >> 32;
+    return static_cast<size_t>((hash * partitions) >> 32);
+}
+
+// Многопоточный UniqueCounts для большого числа различных значений.
+// 1. Радикс-разбиение: потоки строят гистограммы разделов по своим отрезкам,
+//    префиксные суммы дают места, позиции элементов раскладываются по
+//    разделам с сохранением исходного порядка внутри раздела.
+// 2. Каждый раздел обрабатывается своей небольшой хеш-таблицей - одинаковые
+//    значения всегда попадают в один раздел.
+// 3. Первые появления отмечаются в общей битовой маске позиций; ранг позиции
+//    (число отметок до нее) - это место значения в ответе, поэтому порядок
+//    первого появления сохраняется без сортировки.
+// Позиции хранятся в Position. Массив позиций - основная дополнительная
+// память (порядка размера входа), поэтому для входа до 2^32 элементов
+// берется uint32_t: 4 байта на элемент вместо 8
+template<typename Position>
+std::vector<std::pair<int, size_t>> UniqueCountsPartitioned(const std::vector<int>& vec, size_t threads) {
+    const size_t size = vec.size();
+    const size_t partitions = threads;
+
+    // Гистограммы: histogram[t * partitions + p] - элементы раздела p в отрезке t
+    std::vector<size_t> histogram(threads * partitions);
+    RunThreads(threads, [&](size_t t) {
+        for (size_t i = size * t / threads; i < size * (t + 1) / threads; ++i) {
+            ++histogram[t * partitions + PartitionOf(vec[i], partitions)];
+        }
+    });
+
+    // Исключающая префиксная сумма в порядке раздел, затем отрезок
+    std::vector<size_t> partition_begin(partitions + 1);
+    size_t offset = 0;
+    for (size_t p = 0; p < partitions; ++p) {
+        partition_begin[p] = offset;
+        for (size_t t = 0; t < threads; ++t) {
+            size_t count = histogram[t * partitions + p];
+            histogram[t * partitions + p] = offset;
+            offset += count;
+        }
+    }
+    partition_begin[partitions] = offset;
+
+    // Раскладка позиций по разделам
+    std::vector<Position> positions(size);
+    RunThreads(threads, [&](size_t t) {
+        size_t* cursor = histogram.data() + t * partitions;
+        for (size_t i = size * t / threads; i < size * (t + 1) / threads; ++i) {
+            positions[cursor[PartitionOf(vec[i], partitions)]++] = static_cast<Position>(i);
+        }
+    });
+
+    // Подсчет по разделам и отметка первых появлений
+    struct Entry {
+        size_t first;
+        size_t count;
+    };
+    std::vector<std::vector<Entry>> entries(partitions);
+    std::vector<std::atomic<uint64_t>> first_bits((size + 63) / 64);
+    RunThreads(partitions, [&](size_t p) {
+        FirstOccurrenceMap seen;
+        std::vector<Entry>& local = entries[p];
+        for (size_t k = partition_begin[p]; k < partition_begin[p + 1]; ++k) {
+            const size_t i = positions[k];
+            auto [index, inserted] = seen.Insert(vec[i]);
+            if (inserted) {
+                local.push_back(Entry{i, 0});
+                first_bits[i / 64].fetch_or(uint64_t{1} << (i % 64), std::memory_order_relaxed);
+            }
+            ++local[index].count;
+        }
+    });
+
+    // Ранги: число первых появлений до начала каждого слова маски
+    std::vector<size_t> word_rank(first_bits.size());
+    size_t total = 0;
+    for (size_t w = 0; w < first_bits.size(); ++w) {
+        word_rank[w] = total;
+        total += static_cast<size_t>(std::popcount(first_bits[w].load(std::memory_order_relaxed)));
+    }
+
+    // Запись каждого значения на место его ранга - места не пересекаются
+    std::vector<std::pair<int, size_t>> result(total);
+    RunThreads(partitions, [&](size_t p) {
+        for (const Entry& entry : entries[p]) {
+            const uint64_t word = first_bits[entry.first / 64].load(std::memory_order_relaxed);
+            const uint64_t below = word & ((uint64_t{1} << (entry.first % 64)) - 1);
+            const size_t rank = word_rank[entry.first / 64] + static_cast<size_t>(std::popcount(below));
+            result[rank] = {vec[entry.first], entry.count};
+        }
+    });
+    return result;
+}
+
+// 0 потоков - по числу ядер
+std::vector<std::pair<int, size_t>> UniqueCountsParallel(const std::vector<int>& vec, size_t threads = 0) {
+    threads = ParallelThreads(vec.size(), threads);
+    if (threads <= 1) {
+        return UniqueCounts(vec);
+    }
+    if (vec.size() <= std::numeric_limits<uint32_t>::max()) {
+        return UniqueCountsPartitioned<uint32_t>(vec, threads);
+    }
+    return UniqueCountsPartitioned<size_t>(vec, threads);
+}
+
+// Многопоточный UniqueUnsorted на основе UniqueCountsParallel
+std::vector<int> UniqueUnsortedParallel(const std::vector<int>& vec, size_t threads = 0) {
+    auto counts = UniqueCountsParallel(vec, threads);
+    std::vector<int> result(counts.size());
+    for (size_t i = 0; i < counts.size(); ++i) {
+        result[i] = counts[i].first;
+    }
     return result;
-}
\ No newline at end of file
+}
@@ -1,11 +1,12 @@
 #include <vector>
+#include <memory_resource>
 #include <initializer_list>
 #include <algorithm>
 #include <stdexcept>
 
 class RingBuffer {
 private:
-    std::vector<int> data;     // хранилище данных
+    std::pmr::vector<int> data; // хранилище данных
     size_t head;               // индекс самого старого элемента
     size_t tail;               // индекс, куда будет добавлен следующий элемент
     size_t count;              // текущее количество элементов
@@ -24,6 +25,7 @@ private:
 public:
     // Конструкторы
     RingBuffer(size_t capacity);
+    RingBuffer(size_t capacity, std::pmr::memory_resource* resource);
     RingBuffer(size_t capacity, int initial_value);
     RingBuffer(std::initializer_list<int> init);
     
@@ -50,6 +52,7 @@ public:
     bool Full() const;
     size_t Size() const;
     size_t Capacity() const;
+    std::pmr::memory_resource* Resource() const;
     
     // Управление буфером
     void Clear();
@@ -58,7 +61,12 @@ public:
 };
 
 // Конструктор от вместимости буфера
-RingBuffer::RingBuffer(size_t capacity) {
+RingBuffer::RingBuffer(size_t capacity) 
+    : RingBuffer(capacity, std::pmr::get_default_resource()) {}
+
+// Конструктор от вместимости буфера и источника памяти для хранилища
+RingBuffer::RingBuffer(size_t capacity, std::pmr::memory_resource* resource) 
+    : data(resource) {
     size_t actual_capacity = (capacity == 0) ? 1 : capacity;
     data.resize(actual_capacity);
     head = 0;
@@ -101,7 +109,7 @@ RingBuffer::RingBuffer(const RingBuffer& other)
     : data(other.data), head(other.head), tail(other.tail), 
       count(other.count), is_full(other.is_full) {}
 
-// Копирующее присваивание
+// Копирующее присваивание (источник памяти хранилища не меняется)
 RingBuffer& RingBuffer::operator=(const RingBuffer& other) {
     if (this != &other) {
         data = other.data;
@@ -237,6 +245,11 @@ size_t RingBuffer::Capacity() const {
     return data.size();
 }
 
+// Возвращает источник памяти хранилища
+std::pmr::memory_resource* RingBuffer::Resource() const {
+    return data.get_allocator().resource();
+}
+
 // Очищает буфер, сбрасывает позиции в начало
 void RingBuffer::Clear() {
     head = 0;
@@ -255,7 +268,8 @@ void RingBuffer::Resize(size_t new_capacity) {
         return;
     }
     
-    std::vector<int> new_data(new_capacity);
+    // Новое хранилище берется из того же источника памяти
+    std::pmr::vector<int> new_data(new_capacity, data.get_allocator());
     
     if (new_capacity >= count) {
         // Увеличиваем - копируем все элементы
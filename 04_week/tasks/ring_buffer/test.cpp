@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <array>
+#include <memory_resource>
 #include <vector>
 
 #include "ring_buffer.cpp"
@@ -546,4 +548,29 @@ TEST(RingBufferTest, WrapAroundBehavior) {
     EXPECT_EQ(buffer[2], 5);
     EXPECT_EQ(buffer[3], 6);
     EXPECT_EQ(buffer[4], 7);
-}
\ No newline at end of file
+}
+
+TEST(RingBufferTest, MemoryResource) {
+    std::array<std::byte, 256> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                              std::pmr::null_memory_resource());
+    RingBuffer ring(4, &arena);
+    EXPECT_EQ(ring.Resource(), &arena);
+    for (int i = 0; i < 6; ++i) {
+        ring.Push(i);
+    }
+    EXPECT_EQ(ring.Vector(), std::vector<int>({2, 3, 4, 5}));
+
+    // Новое хранилище при Resize берется из той же арены
+    ring.Resize(8);
+    EXPECT_EQ(ring.Resource(), &arena);
+    EXPECT_EQ(ring.Vector(), std::vector<int>({2, 3, 4, 5}));
+    EXPECT_THROW(ring.Resize(1024), std::bad_alloc);
+
+    RingBuffer copy = ring;
+    EXPECT_EQ(copy.Resource(), std::pmr::get_default_resource());
+    RingBuffer target(2, &arena);
+    target = copy;
+    EXPECT_EQ(target.Resource(), &arena);
+    EXPECT_EQ(target.Vector(), ring.Vector());
+}
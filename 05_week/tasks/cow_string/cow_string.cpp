@@ -1,4 +1,6 @@
 #include <cstring>
+#include <memory>
+#include <memory_resource>
 #include <string>
 
 class CowString {
@@ -11,6 +13,9 @@ public:
     CowString();
     CowString(const char* str);
     CowString(const std::string& str);
+    // Строка, буфер которой берется из указанного источника памяти
+    explicit CowString(std::pmr::memory_resource* resource);
+    CowString(const char* str, std::pmr::memory_resource* resource);
     CowString(const CowString& other);
     CowString(CowString&& other) noexcept;
     
@@ -43,26 +48,36 @@ public:
     size_type Find(const char* str) const;
     size_type Find(char ch) const;
     bool Empty() const;
+    std::pmr::memory_resource* Resource() const;
 
 private:
     // Структура для хранения данных и счетчика ссылок
+    // Сама структура и ее буфер живут в одном источнике памяти
     struct StringData {
         char* data;
         size_type size;
         size_type capacity;
         int ref_count;
+        std::pmr::memory_resource* resource;
 
-        StringData(const char* str = "");
-        StringData(size_type count, char ch);
+        StringData();
+        StringData(const char* str, std::pmr::memory_resource* resource);
+        StringData(size_type count, char ch, std::pmr::memory_resource* resource);
         ~StringData();
 
+        static StringData* Create(const char* str, std::pmr::memory_resource* resource);
+        static void Destroy(StringData* string_data);
+        static StringData* SharedEmpty();
+
         void Reserve(size_type new_capacity);
         void Resize(size_type new_size);
     };
 
     StringData* data_;
+    std::pmr::memory_resource* resource_; // источник памяти для новых буферов
 
     // Вспомогательные методы
+    void Share(StringData* data);
     void Detach();
     void Release();
     void CreateEmpty();
@@ -76,34 +91,68 @@ const CowString::size_type CowString::npos = -1;
 
 // Реализация StringData
 
-CowString::StringData::StringData(const char* str) {
+// Пустая строка без выделения памяти: буфер - статический нуль-терминатор,
+// источник - null_memory_resource, освобождение в котором ничего не делает
+CowString::StringData::StringData()
+    : data(const_cast<char*>("")), size(0), capacity(1), ref_count(1),
+      resource(std::pmr::null_memory_resource()) {}
+
+CowString::StringData::StringData(const char* str, std::pmr::memory_resource* resource)
+    : resource(resource) {
     if (str == nullptr) str = "";
     size = strlen(str);
     capacity = size + 1;
-    data = new char[capacity];
+    data = static_cast<char*>(resource->allocate(capacity, alignof(char)));
     memcpy(data, str, size + 1);
     ref_count = 1;
 }
 
-CowString::StringData::StringData(size_type count, char ch) {
+CowString::StringData::StringData(size_type count, char ch, std::pmr::memory_resource* resource)
+    : resource(resource) {
     size = count;
     capacity = size + 1;
-    data = new char[capacity];
+    data = static_cast<char*>(resource->allocate(capacity, alignof(char)));
     memset(data, ch, size);
     data[size] = '\0';
     ref_count = 1;
 }
 
 CowString::StringData::~StringData() {
-    delete[] data;
+    resource->deallocate(data, capacity, alignof(char));
+}
+
+// Размещает StringData в источнике памяти
+CowString::StringData* CowString::StringData::Create(const char* str,
+                                                     std::pmr::memory_resource* resource) {
+    void* memory = resource->allocate(sizeof(StringData), alignof(StringData));
+    try {
+        return ::new (memory) StringData(str, resource);
+    } catch (...) {
+        resource->deallocate(memory, sizeof(StringData), alignof(StringData));
+        throw;
+    }
+}
+
+// Общие данные всех перемещенных строк. Счетчик ссылок этих данных не
+// меняется, поэтому перемещение не выделяет память и не бросает исключений
+CowString::StringData* CowString::StringData::SharedEmpty() {
+    static StringData empty;
+    return &empty;
+}
+
+// Уничтожает StringData и возвращает память ее источнику
+void CowString::StringData::Destroy(StringData* string_data) {
+    std::pmr::memory_resource* resource = string_data->resource;
+    std::destroy_at(string_data);
+    resource->deallocate(string_data, sizeof(StringData), alignof(StringData));
 }
 
 void CowString::StringData::Reserve(size_type new_capacity) {
     if (new_capacity <= capacity) return;
     
-    char* new_data = new char[new_capacity];
+    char* new_data = static_cast<char*>(resource->allocate(new_capacity, alignof(char)));
     memcpy(new_data, data, size + 1);
-    delete[] data;
+    resource->deallocate(data, capacity, alignof(char));
     data = new_data;
     capacity = new_capacity;
 }
@@ -123,38 +172,34 @@ void CowString::StringData::Resize(size_type new_size) {
 // Реализация CowString
 
 // Конструкторы
-CowString::CowString() {
-    data_ = new StringData("");
-}
+CowString::CowString() : CowString(std::pmr::get_default_resource()) {}
 
-CowString::CowString(const char* str) {
-    if (str == nullptr) {
-        data_ = new StringData("");
-    } else {
-        data_ = new StringData(str);
-    }
-}
+CowString::CowString(const char* str) : CowString(str, std::pmr::get_default_resource()) {}
+
+CowString::CowString(const std::string& str) : CowString(str.c_str()) {}
 
-CowString::CowString(const std::string& str) {
-    data_ = new StringData(str.c_str());
+CowString::CowString(std::pmr::memory_resource* resource) : CowString("", resource) {}
+
+CowString::CowString(const char* str, std::pmr::memory_resource* resource) : resource_(resource) {
+    data_ = StringData::Create(str, resource);
 }
 
-CowString::CowString(const CowString& other) {
-    data_ = other.data_;
-    ++data_->ref_count;
+CowString::CowString(const CowString& other) : resource_(other.resource_) {
+    Share(other.data_);
 }
 
-CowString::CowString(CowString&& other) noexcept {
+// Перемещенная строка становится пустой, сохраняя свой источник памяти
+CowString::CowString(CowString&& other) noexcept : resource_(other.resource_) {
     data_ = other.data_;
-    other.data_ = new StringData("");
+    other.data_ = StringData::SharedEmpty();
 }
 
 // Операторы присваивания
 CowString& CowString::operator=(const CowString& other) {
     if (this != &other) {
         Release();
-        data_ = other.data_;
-        ++data_->ref_count;
+        resource_ = other.resource_;
+        Share(other.data_);
     }
     return *this;
 }
@@ -162,8 +207,9 @@ CowString& CowString::operator=(const CowString& other) {
 CowString& CowString::operator=(CowString&& other) noexcept {
     if (this != &other) {
         Release();
+        resource_ = other.resource_;
         data_ = other.data_;
-        other.data_ = new StringData("");
+        other.data_ = StringData::SharedEmpty();
     }
     return *this;
 }
@@ -223,7 +269,7 @@ CowString& CowString::Append(const std::string& str) {
 
 CowString CowString::Substr(size_type pos, size_type count) const {
     if (pos >= data_->size) {
-        return CowString();
+        return CowString(Resource());
     }
     
     size_type real_count = count;
@@ -231,7 +277,7 @@ CowString CowString::Substr(size_type pos, size_type count) const {
         real_count = data_->size - pos;
     }
     
-    CowString result;
+    CowString result(Resource());
     result.Detach(); // Создаем свою копию
     
     result.data_->Resize(real_count);
@@ -245,8 +291,9 @@ void CowString::Clear() {
     if (data_->size == 0) return;
     
     if (!IsUnique()) {
+        StringData* new_data = StringData::Create("", resource_);
         Release();
-        data_ = new StringData("");
+        data_ = new_data;
     } else {
         data_->size = 0;
         data_->data[0] = '\0';
@@ -273,31 +320,47 @@ bool CowString::Empty() const {
     return data_->size == 0;
 }
 
+// Источник памяти буфера (копии делят буфер, а значит и источник)
+std::pmr::memory_resource* CowString::Resource() const {
+    return resource_;
+}
+
 // Вспомогательные методы
+
+// Разделить данные другой строки
+void CowString::Share(StringData* data) {
+    data_ = data;
+    if (data_ != StringData::SharedEmpty()) {
+        ++data_->ref_count;
+    }
+}
+
 void CowString::Detach() {
     if (!IsUnique()) {
-        StringData* new_data = new StringData(data_->data);
-        --data_->ref_count;
+        StringData* new_data = StringData::Create(data_->data, resource_);
+        Release();
         data_ = new_data;
     }
 }
 
 void CowString::Release() {
-    if (data_) {
+    if (data_ && data_ != StringData::SharedEmpty()) {
         --data_->ref_count;
         if (data_->ref_count == 0) {
-            delete data_;
+            StringData::Destroy(data_);
         }
-        data_ = nullptr;
     }
+    data_ = nullptr;
 }
 
 void CowString::CreateEmpty() {
-    data_ = new StringData("");
+    resource_ = std::pmr::get_default_resource();
+    data_ = StringData::Create("", resource_);
 }
 
+// Общие пустые данные никогда не принадлежат одной строке
 bool CowString::IsUnique() const {
-    return data_->ref_count == 1;
+    return data_ != StringData::SharedEmpty() && data_->ref_count == 1;
 }
 
 CowString::size_type CowString::Length() const {
@@ -305,10 +368,6 @@ CowString::size_type CowString::Length() const {
 }
 
 void CowString::CheckAndCopy() {
-    if (!IsUnique()) {
-        StringData* new_data = new StringData(data_->data);
-        --data_->ref_count;
-        data_ = new_data;
-    }
+    Detach();
 }
 
@@ -1,4 +1,7 @@
 #include <gtest/gtest.h>
+#include <array>
+#include <memory_resource>
+#include <type_traits>
 
 #include "cow_string.cpp"
 
@@ -517,3 +520,57 @@ TEST(CowStringTest, EmptyMethod) {
     s1.Clear();
     EXPECT_TRUE(s1.Empty());
 }
+
+TEST(CowStringTest, MemoryResource) {
+    std::array<std::byte, 512> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                              std::pmr::null_memory_resource());
+    CowString s("Hello", &arena);
+    EXPECT_EQ(s.Resource(), &arena);
+    const char* text = s.ToCstr();
+    EXPECT_GE(static_cast<const void*>(text), static_cast<const void*>(buffer.data()));
+    EXPECT_LT(static_cast<const void*>(text), static_cast<const void*>(buffer.data() + buffer.size()));
+
+    // Копия делит буфер, отделившаяся копия остается в той же арене
+    CowString copy = s;
+    EXPECT_EQ(copy.ToCstr(), s.ToCstr());
+    copy.Append(", World");
+    EXPECT_EQ(copy.Resource(), &arena);
+    EXPECT_STREQ(copy.ToCstr(), "Hello, World");
+    EXPECT_STREQ(s.ToCstr(), "Hello");
+
+    CowString sub = copy.Substr(7);
+    EXPECT_EQ(sub.Resource(), &arena);
+    EXPECT_STREQ(sub.ToCstr(), "World");
+
+    EXPECT_THROW(s.Append(std::string(1024, 'x')), std::bad_alloc);
+}
+
+TEST(CowStringTest, MoveFromExhaustedArena) {
+    std::array<std::byte, 128> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                              std::pmr::null_memory_resource());
+    CowString s("Hello", &arena);
+    EXPECT_THROW(s.Append(std::string(256, 'x')), std::bad_alloc);
+
+    // Арена исчерпана, но перемещение не выделяет память
+    static_assert(std::is_nothrow_move_constructible_v<CowString>);
+    CowString moved = std::move(s);
+    EXPECT_STREQ(moved.ToCstr(), "Hello");
+    EXPECT_TRUE(s.Empty());
+    EXPECT_STREQ(s.ToCstr(), "");
+    EXPECT_EQ(s.Resource(), &arena);
+
+    CowString target("World", &arena);
+    target = std::move(moved);
+    EXPECT_STREQ(target.ToCstr(), "Hello");
+    EXPECT_TRUE(moved.Empty());
+
+    // Перемещенная строка снова пригодна для использования
+    CowString reused;
+    CowString other = std::move(reused);
+    reused.Append("again");
+    EXPECT_STREQ(reused.ToCstr(), "again");
+    CowString copy = reused;
+    EXPECT_EQ(copy.ToCstr(), reused.ToCstr());
+}
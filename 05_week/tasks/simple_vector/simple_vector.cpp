@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <initializer_list>
+#include <memory_resource>
 
 class SimpleVector {
 public:
@@ -10,6 +11,11 @@ public:
     SimpleVector(size_t size, int value);
     SimpleVector(std::initializer_list<int> init);
     
+    // Конструкторы с источником памяти (например, аренда на время запроса)
+    explicit SimpleVector(std::pmr::memory_resource* resource);
+    SimpleVector(size_t size, int value, std::pmr::memory_resource* resource);
+    SimpleVector(const SimpleVector& other, std::pmr::memory_resource* resource);
+    
     // Копирование и перемещение
     SimpleVector(const SimpleVector& other);
     SimpleVector(SimpleVector&& other) noexcept;
@@ -25,6 +31,7 @@ public:
     size_t Capacity() const;
     bool Empty() const;
     const int* Data() const;
+    std::pmr::memory_resource* Resource() const;
     
     // Методы модификации
     void PushBack(int value);
@@ -49,48 +56,89 @@ private:
     int* data_;
     size_t size_;
     size_t capacity_;
+    std::pmr::memory_resource* resource_;
+
+    int* Allocate(size_t count);
+    void Deallocate(int* data, size_t count);
 };
 
 // Внешняя функция swap
 void swap(SimpleVector& lhs, SimpleVector& rhs) noexcept;
 
+// Выделение памяти под count элементов из источника памяти вектора
+int* SimpleVector::Allocate(size_t count) {
+    if (count == 0) {
+        return nullptr;
+    }
+    return static_cast<int*>(resource_->allocate(count * sizeof(int), alignof(int)));
+}
+
+// Возврат памяти в источник, из которого она была выделена
+void SimpleVector::Deallocate(int* data, size_t count) {
+    if (data) {
+        resource_->deallocate(data, count * sizeof(int), alignof(int));
+    }
+}
+
 // Конструктор по умолчанию
-SimpleVector::SimpleVector() : data_(nullptr), size_(0), capacity_(0) {}
+SimpleVector::SimpleVector() : SimpleVector(std::pmr::get_default_resource()) {}
+
+// Конструктор пустого вектора с источником памяти
+SimpleVector::SimpleVector(std::pmr::memory_resource* resource)
+    : data_(nullptr), size_(0), capacity_(0), resource_(resource) {}
 
 // Конструктор с размером (заполнение нулями)
-SimpleVector::SimpleVector(size_t size) : data_(new int[size]), size_(size), capacity_(size) {
-    std::fill(data_, data_ + size_, 0);
-}
+SimpleVector::SimpleVector(size_t size) : SimpleVector(size, 0) {}
 
 // Конструктор с размером и значением
-SimpleVector::SimpleVector(size_t size, int value) : data_(new int[size]), size_(size), capacity_(size) {
+SimpleVector::SimpleVector(size_t size, int value)
+    : SimpleVector(size, value, std::pmr::get_default_resource()) {}
+
+// Конструктор с размером, значением и источником памяти
+SimpleVector::SimpleVector(size_t size, int value, std::pmr::memory_resource* resource)
+    : SimpleVector(resource) {
+    data_ = Allocate(size);
+    size_ = size;
+    capacity_ = size;
     std::fill(data_, data_ + size_, value);
 }
 
 // Конструктор от initializer_list
 SimpleVector::SimpleVector(std::initializer_list<int> init) 
-    : data_(new int[init.size()]), size_(init.size()), capacity_(init.size()) {
+    : SimpleVector(std::pmr::get_default_resource()) {
+    data_ = Allocate(init.size());
+    size_ = init.size();
+    capacity_ = init.size();
     std::copy(init.begin(), init.end(), data_);
 }
 
-// Конструктор копирования (с запасом по capacity)
+// Конструктор копирования (с запасом по capacity). Как и у std::pmr контейнеров,
+// копия не наследует источник памяти оригинала
 SimpleVector::SimpleVector(const SimpleVector& other) 
-    : data_(new int[other.capacity_]), size_(other.size_), capacity_(other.capacity_) {
+    : SimpleVector(other, std::pmr::get_default_resource()) {}
+
+// Конструктор копирования в указанный источник памяти
+SimpleVector::SimpleVector(const SimpleVector& other, std::pmr::memory_resource* resource)
+    : SimpleVector(resource) {
+    data_ = Allocate(other.capacity_);
+    size_ = other.size_;
+    capacity_ = other.capacity_;
     std::copy(other.data_, other.data_ + other.size_, data_);
 }
 
-// Конструктор перемещения
+// Конструктор перемещения (источник памяти переезжает вместе с данными)
 SimpleVector::SimpleVector(SimpleVector&& other) noexcept 
-    : data_(other.data_), size_(other.size_), capacity_(other.capacity_) {
+    : data_(other.data_), size_(other.size_), capacity_(other.capacity_),
+      resource_(other.resource_) {
     other.data_ = nullptr;
     other.size_ = 0;
     other.capacity_ = 0;
 }
 
-// Оператор присваивания копированием
+// Оператор присваивания копированием (источник памяти не меняется)
 SimpleVector& SimpleVector::operator=(const SimpleVector& other) {
     if (this != &other) {
-        SimpleVector tmp(other);
+        SimpleVector tmp(other, resource_);
         Swap(tmp);
     }
     return *this;
@@ -99,11 +147,12 @@ SimpleVector& SimpleVector::operator=(const SimpleVector& other) {
 // Оператор присваивания перемещением
 SimpleVector& SimpleVector::operator=(SimpleVector&& other) noexcept {
     if (this != &other) {
-        delete[] data_;
+        Deallocate(data_, capacity_);
         
         data_ = other.data_;
         size_ = other.size_;
         capacity_ = other.capacity_;
+        resource_ = other.resource_;
         
         other.data_ = nullptr;
         other.size_ = 0;
@@ -114,13 +163,14 @@ SimpleVector& SimpleVector::operator=(SimpleVector&& other) noexcept {
 
 // Деструктор
 SimpleVector::~SimpleVector() {
-    delete[] data_;
+    Deallocate(data_, capacity_);
 }
 
 void SimpleVector::Swap(SimpleVector& other) noexcept {
     std::swap(data_, other.data_);
     std::swap(size_, other.size_);
     std::swap(capacity_, other.capacity_);
+    std::swap(resource_, other.resource_);
 }
 
 int& SimpleVector::operator[](size_t index) {
@@ -150,6 +200,10 @@ const int* SimpleVector::Data() const {
     return data_;
 }
 
+std::pmr::memory_resource* SimpleVector::Resource() const {
+    return resource_;
+}
+
 void SimpleVector::PushBack(int value) {
     if (size_ == capacity_) {
         size_t new_capacity = capacity_ == 0 ? 1 : capacity_ * 2;
@@ -173,7 +227,7 @@ int* SimpleVector::Insert(const int* pos, int value) {
     
     if (size_ == capacity_) {
         size_t new_capacity = capacity_ == 0 ? 1 : capacity_ * 2;
-        int* new_data = new int[new_capacity];
+        int* new_data = Allocate(new_capacity);
         
         // Копируем элементы до позиции вставки
         std::copy(data_, data_ + index, new_data);
@@ -182,7 +236,7 @@ int* SimpleVector::Insert(const int* pos, int value) {
         // Копируем оставшиеся элементы
         std::copy(data_ + index, data_ + size_, new_data + index + 1);
         
-        delete[] data_;
+        Deallocate(data_, capacity_);
         data_ = new_data;
         capacity_ = new_capacity;
     } else {
@@ -228,10 +282,10 @@ void SimpleVector::Resize(size_t new_size, int value) {
 
 void SimpleVector::Reserve(size_t new_capacity) {
     if (new_capacity > capacity_) {
-        int* new_data = new int[new_capacity];
+        int* new_data = Allocate(new_capacity);
         std::copy(data_, data_ + size_, new_data);
         
-        delete[] data_;
+        Deallocate(data_, capacity_);
         data_ = new_data;
         capacity_ = new_capacity;
     }
@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <array>
+#include <memory_resource>
 
 #include "simple_vector.cpp"
 
@@ -394,4 +396,31 @@ TEST(SimpleVectorTest, WorkAfterMoveAssignment) {
     original.PushBack(17);
     EXPECT_EQ(original.Size(), 1);
     EXPECT_EQ(original[0], 17);
-}
\ No newline at end of file
+}
+
+TEST(SimpleVectorTest, MemoryResource) {
+    // Арена без запасного источника: любая память не из буфера - bad_alloc
+    std::array<std::byte, 256> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                              std::pmr::null_memory_resource());
+    SimpleVector v(&arena);
+    EXPECT_EQ(v.Resource(), &arena);
+    for (int i = 0; i < 16; ++i) {
+        v.PushBack(i);
+    }
+    EXPECT_EQ(v.Size(), 16);
+    EXPECT_GE(static_cast<void*>(v.begin()), static_cast<void*>(buffer.data()));
+    EXPECT_LT(static_cast<void*>(v.begin()), static_cast<void*>(buffer.data() + buffer.size()));
+    EXPECT_THROW(v.Reserve(1024), std::bad_alloc);
+
+    // Копия по умолчанию уходит в общий источник, копирующее присваивание
+    // сохраняет свой, перемещение забирает буфер вместе с источником
+    SimpleVector copy = v;
+    EXPECT_EQ(copy.Resource(), std::pmr::get_default_resource());
+    SimpleVector target(&arena);
+    target = copy;
+    EXPECT_EQ(target.Resource(), &arena);
+    EXPECT_EQ(target[15], 15);
+    target = SimpleVector(2, 7);
+    EXPECT_EQ(target.Resource(), std::pmr::get_default_resource());
+}
@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <memory_resource>
+#include <set>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "tracer.cpp"
@@ -368,3 +372,189 @@ TEST_F(TracerTest, StdSwapUsesMoveOperations) {
     // std::swap uses move construction and move assignment
     EXPECT_EQ(Tracer::move_ctor + Tracer::move_assign, 3);
 }
+
+TEST_F(TracerTest, CountersAcrossThreads) {
+    const int kThreads = 4;
+    const int kIterations = 1000;
+    std::vector<std::vector<int64_t>> ids(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&ids, t] {
+            for (int i = 0; i < kIterations; ++i) {
+                Tracer original("t");
+                Tracer copy = original;
+                Tracer moved = std::move(copy);
+                ids[t].push_back(original.Id());
+                ids[t].push_back(copy.Id());
+                ids[t].push_back(moved.Id());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Шарды завершившихся потоков учтены в сумме
+    EXPECT_EQ(Tracer::count, 3 * kThreads * kIterations);
+    EXPECT_EQ(Tracer::str_ctor, kThreads * kIterations);
+    EXPECT_EQ(Tracer::copy_ctor, kThreads * kIterations);
+    EXPECT_EQ(Tracer::move_ctor, kThreads * kIterations);
+    EXPECT_EQ(Tracer::dtor, 3 * kThreads * kIterations);
+    EXPECT_EQ(Tracer::alive, 0);
+
+    std::set<int64_t> unique_ids;
+    for (const auto& thread_ids : ids) {
+        unique_ids.insert(thread_ids.begin(), thread_ids.end());
+    }
+    EXPECT_EQ(unique_ids.size(), static_cast<size_t>(3 * kThreads * kIterations));
+}
+
+TEST_F(TracerTest, ResetStatsUnderConcurrency) {
+    std::atomic<bool> stop = false;
+    std::thread worker([&stop] {
+        while (!stop.load()) {
+            Tracer obj;
+        }
+    });
+
+    Tracer::ResetStats();
+    Tracer kept("kept");
+    stop.store(true);
+    worker.join();
+
+    // Сброс видит конструктор и деструктор целиком, но объект рабочего потока,
+    // созданный до сброса и уничтоженный после, учтен только деструктором
+    EXPECT_GE(Tracer::alive, 0);
+    EXPECT_LE(Tracer::alive, 1);
+    EXPECT_GE(Tracer::dtor + Tracer::alive, Tracer::count);
+    EXPECT_LE(Tracer::dtor + Tracer::alive, Tracer::count + 1);
+}
+
+TEST_F(TracerTest, CopyAuditRecordsDeltas) {
+    CopyAudit audit;
+    std::vector<Tracer> items;
+    items.reserve(4);
+
+    const AuditRecord& push = audit.Run("push_back(move)", [&items] {
+        Tracer item("item");
+        items.push_back(std::move(item));
+    });
+    EXPECT_EQ(push.stats.str_ctor, 1);
+    EXPECT_EQ(push.stats.move_ctor, 1);
+    EXPECT_EQ(push.stats.Copies(), 0);
+    EXPECT_EQ(push.stats.dtor, 1);
+
+    const AuditRecord& copy = audit.Run("copy", [&items] {
+        std::vector<Tracer> copy = items;
+    });
+    EXPECT_EQ(copy.stats.copy_ctor, 1);
+    EXPECT_EQ(copy.stats.Moves(), 0);
+    EXPECT_EQ(audit.Records().size(), 2);
+}
+
+TEST_F(TracerTest, CopyAuditReports) {
+    CopyAudit audit;
+    audit.Run("make \"a\"", [] {
+        Tracer a;
+        Tracer b = a;
+    });
+
+    EXPECT_EQ(audit.Json(),
+              "[{\"operation\":\"make \\\"a\\\"\",\"default_ctor\":1,\"str_ctor\":0,"
+              "\"copy_ctor\":1,\"move_ctor\":0,\"copy_assign\":0,\"move_assign\":0,"
+              "\"dtor\":2}]");
+    EXPECT_EQ(audit.Table(),
+              "operation    ctor    copy    move   copy=   move=    dtor\n"
+              "make \"a\"        1       1       0       0       0       2\n");
+
+    // Управляющие символы в имени не ломают JSON
+    CopyAudit control;
+    control.Run("a\nb\tc\rd\be\ff\x01g\x1f", [] {});
+    EXPECT_EQ(control.Json(),
+              "[{\"operation\":\"a\\nb\\tc\\rd\\be\\ff\\u0001g\\u001f\",\"default_ctor\":0,"
+              "\"str_ctor\":0,\"copy_ctor\":0,\"move_ctor\":0,\"copy_assign\":0,"
+              "\"move_assign\":0,\"dtor\":0}]");
+}
+
+TEST_F(TracerTest, TraceScopeRecordsRegion) {
+    TraceLog::Instance().Clear();
+    CountingResource counting;
+    {
+        TraceScope scope("copy_vector");
+        std::pmr::vector<int> numbers({1, 2, 3, 4}, &counting);
+        Tracer original("scoped");
+        Tracer copy = original;
+        Tracer moved = std::move(copy);
+    }
+
+    std::string json = TraceLog::Instance().ChromeJson();
+    EXPECT_EQ(json.find("{\"traceEvents\":[{\"name\":\"copy_vector\",\"ph\":\"X\""), 0);
+    EXPECT_NE(json.find("\"allocations\":1,\"bytes\":16,\"copies\":1,\"moves\":1}"),
+              std::string::npos);
+    EXPECT_EQ(TraceLog::Instance().Dropped(), 0);
+}
+
+TEST_F(TracerTest, TraceScopePerThreadBuffers) {
+    TraceLog::Instance().Clear();
+    const int kThreads = 4;
+    const int kScopes = 100;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([] {
+            for (int i = 0; i < kScopes; ++i) {
+                TraceScope outer("outer");
+                TraceScope inner("inner");
+            }
+        });
+    }
+    // Экспорт во время записи видит только опубликованные события
+    std::string partial = TraceLog::Instance().ChromeJson();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::string json = TraceLog::Instance().ChromeJson();
+    size_t events = 0;
+    for (size_t pos = json.find("\"ph\":\"X\""); pos != std::string::npos;
+         pos = json.find("\"ph\":\"X\"", pos + 1)) {
+        ++events;
+    }
+    EXPECT_EQ(events, static_cast<size_t>(2 * kThreads * kScopes));
+    EXPECT_LE(partial.size(), json.size());
+}
+
+TEST_F(TracerTest, TraceScopeEscapesName) {
+    TraceLog::Instance().Clear();
+    {
+        TraceScope scope("say \"hi\" \\ bye");
+    }
+    std::string json = TraceLog::Instance().ChromeJson();
+    EXPECT_EQ(json.find("{\"traceEvents\":[{\"name\":\"say \\\"hi\\\" \\\\ bye\",\"ph\":\"X\""), 0);
+}
+
+TEST_F(TracerTest, TraceScopeReusesBuffersOfExitedThreads) {
+    auto run_batch = [] {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([] {
+                TraceScope scope("batch");
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    };
+
+    TraceLog::Instance().Clear();
+    run_batch();
+    size_t buffers = TraceLog::Instance().Buffers();
+    EXPECT_LE(buffers, TraceLog::kMaxBuffers);
+
+    // После сброса событий буферы завершившихся потоков достаются новым потокам
+    for (int batch = 0; batch < 8; ++batch) {
+        TraceLog::Instance().Clear();
+        run_batch();
+        EXPECT_EQ(TraceLog::Instance().Buffers(), buffers);
+    }
+    EXPECT_EQ(TraceLog::Instance().Dropped(), 0);
+}
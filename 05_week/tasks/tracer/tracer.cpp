@@ -1,22 +1,134 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Реестр счетчиков, разбитых по потокам. Каждый поток пишет только в свой
+// шард (без атомарных RMW и без борьбы за кеш-линию), чтение суммирует шарды.
+// Шард завершившегося потока сливается в общий остаток
+class CounterRegistry {
+public:
+    static constexpr size_t kSlots = 9;
+
+    // Шард одного потока. Пишет только владелец, читают все.
+    // Нечетный sequence - владелец посреди группы изменений (Update)
+    struct alignas(64) Shard {
+        std::atomic<int64_t> values[kSlots] = {};
+        std::atomic<uint64_t> sequence = 0;
+
+        Shard();
+        ~Shard();
+
+        // Согласованная копия значений: не попадает в середину Update
+        void Read(int64_t (&out)[kSlots]) const;
+    };
+
+    // Группа изменений шарда текущего потока, которую Reset и чтение
+    // видят целиком или не видят вовсе (например, все счетчики одного
+    // конструктора)
+    class Update {
+    private:
+        Shard& shard_;
+
+    public:
+        Update();
+        ~Update();
+
+        Update(const Update&) = delete;
+        Update& operator=(const Update&) = delete;
+    };
+
+    static CounterRegistry& Instance();
+    static Shard& LocalShard();
+
+    int64_t Load(size_t slot);
+    // Все счетчики одним снимком
+    void LoadAll(int64_t (&out)[kSlots]);
+    void Reset();
+
+private:
+    std::mutex mutex_;
+    std::vector<Shard*> shards_;
+    int64_t retired_[kSlots] = {};   // сумма шардов завершившихся потоков
+    int64_t baseline_[kSlots] = {};  // сумма на момент последнего Reset
+
+    void SumLocked(int64_t (&out)[kSlots]) const;
+};
+
+// Счетчик из реестра. Увеличение - запись в шард своего потока,
+// значение - сумма по всем потокам
+class ShardedCounter {
+private:
+    size_t slot_;
+
+public:
+    explicit ShardedCounter(size_t slot);
+
+    ShardedCounter& operator++();
+    ShardedCounter& operator--();
+    void Add(int64_t delta);
+
+    size_t Slot() const;
+    int64_t Load() const;
+    int64_t LocalValue() const;
+    operator int64_t() const;
+};
+
+// Снимок счетчиков Tracer (или разность двух снимков)
+struct TracerStats {
+    int64_t default_ctor = 0;
+    int64_t str_ctor = 0;
+    int64_t copy_ctor = 0;
+    int64_t move_ctor = 0;
+    int64_t copy_assign = 0;
+    int64_t move_assign = 0;
+    int64_t dtor = 0;
+
+    int64_t Copies() const;
+    int64_t Moves() const;
+};
+
+TracerStats operator-(const TracerStats& lhs, const TracerStats& rhs);
 
 class Tracer {
 public:
-    // Статические счетчики
-    static int count;
-    static int default_ctor;
-    static int str_ctor;
-    static int copy_ctor;
-    static int move_ctor;
-    static int copy_assign;
-    static int move_assign;
-    static int dtor;
-    static int alive;
+    // Статические счетчики (безопасны для использования из разных потоков)
+    static ShardedCounter count;
+    static ShardedCounter default_ctor;
+    static ShardedCounter str_ctor;
+    static ShardedCounter copy_ctor;
+    static ShardedCounter move_ctor;
+    static ShardedCounter copy_assign;
+    static ShardedCounter move_assign;
+    static ShardedCounter dtor;
+    static ShardedCounter alive;
 
 private:
     std::string name_;
-    int id_;
+    int64_t id_;
+
+    // Идентификаторы выдаются потоку блоками, чтобы не обращаться
+    // к общему счетчику при каждом создании объекта
+    static constexpr int64_t kIdBlock = 1024;
+    static std::atomic<int64_t> next_id_block_;
+    static std::atomic<uint64_t> id_generation_;
+
+    static int64_t NextId();
 
 public:
     // Конструкторы
@@ -33,49 +145,346 @@ public:
     ~Tracer();
     
     // Геттеры
-    int Id() const;
+    int64_t Id() const;
     const std::string& Name() const;
     const char* Data() const;
     
     // Сброс статистики
     static void ResetStats();
+    // Текущие значения счетчиков
+    static TracerStats Stats();
+    // Счетчики текущего потока без учета сброса (для разностей)
+    static TracerStats ThreadStats();
+};
+
+// Запись аудита: сколько раз копировались и перемещались Tracer за операцию
+struct AuditRecord {
+    std::string name;
+    TracerStats stats;
+};
+
+// Аудит копирований и перемещений. Run выполняет операцию над контейнером
+// из Tracer и запоминает разность счетчиков до и после нее. Отчет выводится
+// таблицей (для чтения) или JSON (для сравнения между сборками)
+class CopyAudit {
+private:
+    std::vector<AuditRecord> records_;
+
+public:
+    template<typename Operation>
+    const AuditRecord& Run(const std::string& name, Operation&& operation);
+
+    const std::vector<AuditRecord>& Records() const;
+    std::string Table() const;
+    std::string Json() const;
+};
+
+// Ресурс памяти, считающий выделения в текущем потоке. Установленный
+// как ресурс по умолчанию (std::pmr::set_default_resource), он учитывает
+// память контейнеров, которые берут ее из std::pmr::get_default_resource()
+class CountingResource : public std::pmr::memory_resource {
+private:
+    std::pmr::memory_resource* upstream_;
+
+    static thread_local int64_t thread_allocations_;
+    static thread_local int64_t thread_bytes_;
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+    // Счетчики текущего потока (по всем CountingResource)
+    static int64_t ThreadAllocations();
+    static int64_t ThreadBytes();
+};
+
+// Событие трассы: именованный интервал одного потока
+struct TraceEvent {
+    const char* name;
+    int64_t start_ns;
+    int64_t duration_ns;
+    int64_t cycles;
+    int64_t allocations;
+    int64_t bytes;
+    int64_t copies;
+    int64_t moves;
 };
 
+// Журнал событий. У каждого потока свой буфер фиксированного размера:
+// запись в него не берет блокировок, а экспорт читает только события,
+// опубликованные счетчиком size. Когда буфер полон, события отбрасываются
+class TraceLog {
+public:
+    static constexpr size_t kBufferCapacity = 4096;
+    // Предел числа буферов: потоки сверх него только считают отброшенные события
+    static constexpr size_t kMaxBuffers = 64;
+
+    struct Buffer {
+        std::unique_ptr<TraceEvent[]> events;
+        size_t capacity;
+        std::atomic<size_t> size = 0;
+        std::atomic<int64_t> dropped = 0;
+        size_t thread_index;
+        bool in_use = true;  // поток-владелец жив (под mutex_)
+
+        Buffer(size_t index, size_t capacity);
+        void Push(const TraceEvent& event);
+    };
+
+    static TraceLog& Instance();
+    static Buffer& LocalBuffer();
+
+    int64_t Dropped();
+    size_t Buffers();
+    // Экспорт в формате Chrome trace-event (chrome://tracing, Perfetto)
+    std::string ChromeJson();
+    // Очистка. Вызывать, когда другие потоки не пишут в журнал
+    void Clear();
+
+private:
+    // Буфер потока: берется при первой записи и возвращается при завершении потока
+    struct Lease {
+        Buffer* buffer;
+
+        Lease();
+        ~Lease();
+    };
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<Buffer>> buffers_;  // буферы живут дольше потоков
+    Buffer overflow_{0, 0};                         // общий для потоков сверх kMaxBuffers
+    size_t next_thread_index_ = 1;
+    std::chrono::steady_clock::time_point origin_ = std::chrono::steady_clock::now();
+
+    Buffer& Acquire();
+    void Release(Buffer& buffer);
+    int64_t NowNs() const;
+
+    friend class TraceScope;
+};
+
+// RAII-интервал: от создания до уничтожения записывает время, такты
+// процессора, выделения памяти и копирования/перемещения Tracer потока.
+// Имя должно жить дольше журнала (обычно строковый литерал)
+class TraceScope {
+private:
+    const char* name_;
+    int64_t start_ns_;
+    int64_t start_cycles_;
+    int64_t start_allocations_;
+    int64_t start_bytes_;
+    TracerStats start_stats_;
+
+    static int64_t Cycles();
+
+public:
+    explicit TraceScope(const char* name);
+    ~TraceScope();
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+};
+
+// Реализация CounterRegistry
+
+// Регистрация шарда нового потока
+CounterRegistry::Shard::Shard() {
+    CounterRegistry& registry = Instance();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    registry.shards_.push_back(this);
+}
+
+// Поток завершается: значения переносятся в общий остаток
+CounterRegistry::Shard::~Shard() {
+    CounterRegistry& registry = Instance();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    for (size_t slot = 0; slot < kSlots; ++slot) {
+        registry.retired_[slot] += values[slot].load(std::memory_order_relaxed);
+    }
+    registry.shards_.erase(std::find(registry.shards_.begin(), registry.shards_.end(), this));
+}
+
+// Чтение по схеме seqlock: повторяется, пока владелец менял шард.
+// Значения пишутся с release, поэтому прочитав значение из середины
+// Update, второе чтение sequence увидит его изменение
+void CounterRegistry::Shard::Read(int64_t (&out)[kSlots]) const {
+    while (true) {
+        uint64_t before = sequence.load(std::memory_order_acquire);
+        if (before % 2 == 1) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (size_t slot = 0; slot < kSlots; ++slot) {
+            out[slot] = values[slot].load(std::memory_order_acquire);
+        }
+        if (sequence.load(std::memory_order_relaxed) == before) {
+            return;
+        }
+    }
+}
+
+CounterRegistry::Update::Update() : shard_(LocalShard()) {
+    uint64_t sequence = shard_.sequence.load(std::memory_order_relaxed);
+    shard_.sequence.store(sequence + 1, std::memory_order_relaxed);
+}
+
+CounterRegistry::Update::~Update() {
+    uint64_t sequence = shard_.sequence.load(std::memory_order_relaxed);
+    shard_.sequence.store(sequence + 1, std::memory_order_release);
+}
+
+CounterRegistry& CounterRegistry::Instance() {
+    static CounterRegistry registry;
+    return registry;
+}
+
+CounterRegistry::Shard& CounterRegistry::LocalShard() {
+    thread_local Shard shard;
+    return shard;
+}
+
+// Сумма по всем потокам с момента последнего Reset
+int64_t CounterRegistry::Load(size_t slot) {
+    int64_t values[kSlots];
+    LoadAll(values);
+    return values[slot];
+}
+
+void CounterRegistry::LoadAll(int64_t (&out)[kSlots]) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SumLocked(out);
+    for (size_t slot = 0; slot < kSlots; ++slot) {
+        out[slot] -= baseline_[slot];
+    }
+}
+
+// Сброс не трогает чужие шарды: запоминается текущая сумма, от которой
+// дальше ведется отсчет. Поэтому сброс не теряет и не портит увеличения,
+// которые идут в других потоках одновременно с ним. Группы Update
+// попадают в сумму целиком, так что связанные счетчики (count, dtor
+// и alive) остаются согласованными
+void CounterRegistry::Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SumLocked(baseline_);
+}
+
+void CounterRegistry::SumLocked(int64_t (&out)[kSlots]) const {
+    std::copy(std::begin(retired_), std::end(retired_), out);
+    for (const Shard* shard : shards_) {
+        int64_t values[kSlots];
+        shard->Read(values);
+        for (size_t slot = 0; slot < kSlots; ++slot) {
+            out[slot] += values[slot];
+        }
+    }
+}
+
+// Реализация ShardedCounter
+
+ShardedCounter::ShardedCounter(size_t slot) : slot_(slot) {}
+
+ShardedCounter& ShardedCounter::operator++() {
+    Add(1);
+    return *this;
+}
+
+ShardedCounter& ShardedCounter::operator--() {
+    Add(-1);
+    return *this;
+}
+
+// Пишет только поток-владелец шарда, поэтому достаточно load + store.
+// Release не дает записи обогнать открытие Update (на x86 это обычная запись)
+void ShardedCounter::Add(int64_t delta) {
+    std::atomic<int64_t>& value = CounterRegistry::LocalShard().values[slot_];
+    value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_release);
+}
+
+size_t ShardedCounter::Slot() const {
+    return slot_;
+}
+
+int64_t ShardedCounter::Load() const {
+    return CounterRegistry::Instance().Load(slot_);
+}
+
+// Значение в шарде текущего потока
+int64_t ShardedCounter::LocalValue() const {
+    return CounterRegistry::LocalShard().values[slot_].load(std::memory_order_relaxed);
+}
+
+ShardedCounter::operator int64_t() const {
+    return Load();
+}
+
 // Инициализация статических членов класса
-int Tracer::count = 0;
-int Tracer::default_ctor = 0;
-int Tracer::str_ctor = 0;
-int Tracer::copy_ctor = 0;
-int Tracer::move_ctor = 0;
-int Tracer::copy_assign = 0;
-int Tracer::move_assign = 0;
-int Tracer::dtor = 0;
-int Tracer::alive = 0;
+ShardedCounter Tracer::count(0);
+ShardedCounter Tracer::default_ctor(1);
+ShardedCounter Tracer::str_ctor(2);
+ShardedCounter Tracer::copy_ctor(3);
+ShardedCounter Tracer::move_ctor(4);
+ShardedCounter Tracer::copy_assign(5);
+ShardedCounter Tracer::move_assign(6);
+ShardedCounter Tracer::dtor(7);
+ShardedCounter Tracer::alive(8);
+std::atomic<int64_t> Tracer::next_id_block_(0);
+std::atomic<uint64_t> Tracer::id_generation_(0);
 
 // Определения методов
 
+// Следующий id из блока текущего потока. После ResetStats блок выдается
+// заново, поэтому в однопоточном коде id снова идут с 1. Уникальность
+// гарантируется между сбросами
+int64_t Tracer::NextId() {
+    struct IdBlock {
+        int64_t next = 0;
+        int64_t end = 0;
+        uint64_t generation = 0;
+    };
+    thread_local IdBlock block;
+
+    uint64_t generation = id_generation_.load(std::memory_order_acquire);
+    if (block.next == block.end || block.generation != generation) {
+        block.next = next_id_block_.fetch_add(kIdBlock, std::memory_order_relaxed) + 1;
+        block.end = block.next + kIdBlock;
+        block.generation = generation;
+    }
+    return block.next++;
+}
+
 // Конструктор по умолчанию
-Tracer::Tracer() : id_(++count) {
+Tracer::Tracer() : id_(NextId()) {
     name_ = "obj_" + std::to_string(id_);
+    CounterRegistry::Update update;
+    ++count;
     ++default_ctor;
     ++alive;
 }
 
 // Конструктор от строки
-Tracer::Tracer(const std::string& name) : id_(++count) {
+Tracer::Tracer(const std::string& name) : id_(NextId()) {
     name_ = name + "_" + std::to_string(id_);
+    CounterRegistry::Update update;
+    ++count;
     ++str_ctor;
     ++alive;
 }
 
 // Конструктор копирования
-Tracer::Tracer(const Tracer& other) : name_(other.name_), id_(++count) {
+Tracer::Tracer(const Tracer& other) : name_(other.name_), id_(NextId()) {
+    CounterRegistry::Update update;
+    ++count;
     ++copy_ctor;
     ++alive;
 }
 
 // Конструктор перемещения
-Tracer::Tracer(Tracer&& other) noexcept : name_(std::move(other.name_)), id_(++count) {
+Tracer::Tracer(Tracer&& other) noexcept : name_(std::move(other.name_)), id_(NextId()) {
+    CounterRegistry::Update update;
+    ++count;
     ++move_ctor;
     ++alive;
     other.name_.clear();
@@ -102,12 +511,13 @@ Tracer& Tracer::operator=(Tracer&& other) noexcept {
 
 // Деструктор
 Tracer::~Tracer() {
+    CounterRegistry::Update update;
     ++dtor;
     --alive;
 }
 
 // Геттеры
-int Tracer::Id() const {
+int64_t Tracer::Id() const {
     return id_;
 }
 
@@ -119,15 +529,346 @@ const char* Tracer::Data() const {
     return name_.data();
 }
 
-// Сброс статистики
+// Сброс статистики. Безопасен при одновременной работе других потоков
 void Tracer::ResetStats() {
-    count = 0;
-    default_ctor = 0;
-    str_ctor = 0;
-    copy_ctor = 0;
-    move_ctor = 0;
-    copy_assign = 0;
-    move_assign = 0;
-    dtor = 0;
-    alive = 0;
+    CounterRegistry::Instance().Reset();
+    next_id_block_.store(0, std::memory_order_relaxed);
+    id_generation_.fetch_add(1, std::memory_order_release);
+}
+
+// Текущие значения счетчиков одним снимком
+TracerStats Tracer::Stats() {
+    int64_t values[CounterRegistry::kSlots];
+    CounterRegistry::Instance().LoadAll(values);
+
+    TracerStats stats;
+    stats.default_ctor = values[default_ctor.Slot()];
+    stats.str_ctor = values[str_ctor.Slot()];
+    stats.copy_ctor = values[copy_ctor.Slot()];
+    stats.move_ctor = values[move_ctor.Slot()];
+    stats.copy_assign = values[copy_assign.Slot()];
+    stats.move_assign = values[move_assign.Slot()];
+    stats.dtor = values[dtor.Slot()];
+    return stats;
+}
+
+// Счетчики текущего потока без учета сброса (для разностей)
+TracerStats Tracer::ThreadStats() {
+    TracerStats stats;
+    stats.default_ctor = default_ctor.LocalValue();
+    stats.str_ctor = str_ctor.LocalValue();
+    stats.copy_ctor = copy_ctor.LocalValue();
+    stats.move_ctor = move_ctor.LocalValue();
+    stats.copy_assign = copy_assign.LocalValue();
+    stats.move_assign = move_assign.LocalValue();
+    stats.dtor = dtor.LocalValue();
+    return stats;
+}
+
+// Реализация TracerStats
+
+int64_t TracerStats::Copies() const {
+    return copy_ctor + copy_assign;
+}
+
+int64_t TracerStats::Moves() const {
+    return move_ctor + move_assign;
+}
+
+TracerStats operator-(const TracerStats& lhs, const TracerStats& rhs) {
+    TracerStats result;
+    result.default_ctor = lhs.default_ctor - rhs.default_ctor;
+    result.str_ctor = lhs.str_ctor - rhs.str_ctor;
+    result.copy_ctor = lhs.copy_ctor - rhs.copy_ctor;
+    result.move_ctor = lhs.move_ctor - rhs.move_ctor;
+    result.copy_assign = lhs.copy_assign - rhs.copy_assign;
+    result.move_assign = lhs.move_assign - rhs.move_assign;
+    result.dtor = lhs.dtor - rhs.dtor;
+    return result;
+}
+
+// Реализация CopyAudit
+
+// Выполнить операцию и записать изменение счетчиков
+template<typename Operation>
+const AuditRecord& CopyAudit::Run(const std::string& name, Operation&& operation) {
+    TracerStats before = Tracer::Stats();
+    std::forward<Operation>(operation)();
+    records_.push_back({name, Tracer::Stats() - before});
+    return records_.back();
+}
+
+const std::vector<AuditRecord>& CopyAudit::Records() const {
+    return records_;
+}
+
+// Отчет в виде таблицы: операция и ее счетчики по столбцам
+std::string CopyAudit::Table() const {
+    size_t name_width = 9;  // длина заголовка "operation"
+    for (const AuditRecord& record : records_) {
+        name_width = std::max(name_width, record.name.size());
+    }
+
+    std::ostringstream out;
+    out << std::left << std::setw(name_width) << "operation" << std::right
+        << std::setw(8) << "ctor" << std::setw(8) << "copy"
+        << std::setw(8) << "move" << std::setw(8) << "copy="
+        << std::setw(8) << "move=" << std::setw(8) << "dtor" << '\n';
+    for (const AuditRecord& record : records_) {
+        const TracerStats& stats = record.stats;
+        out << std::left << std::setw(name_width) << record.name << std::right
+            << std::setw(8) << stats.default_ctor + stats.str_ctor
+            << std::setw(8) << stats.copy_ctor << std::setw(8) << stats.move_ctor
+            << std::setw(8) << stats.copy_assign << std::setw(8) << stats.move_assign
+            << std::setw(8) << stats.dtor << '\n';
+    }
+    return out.str();
+}
+
+// Строка JSON в кавычках: кавычки, обратная косая черта и управляющие
+// символы (коды меньше 0x20) экранируются, остальные байты пишутся как есть
+void WriteJsonString(std::ostream& out, std::string_view text) {
+    static const char kHexDigits[] = "0123456789abcdef";
+    out << '"';
+    for (char ch : text) {
+        switch (ch) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            case '\r':
+                out << "\\r";
+                break;
+            case '\t':
+                out << "\\t";
+                break;
+            case '\b':
+                out << "\\b";
+                break;
+            case '\f':
+                out << "\\f";
+                break;
+            default: {
+                const unsigned char code = static_cast<unsigned char>(ch);
+                if (code < 0x20) {
+                    out << "\\u00" << kHexDigits[code >> 4] << kHexDigits[code & 0xF];
+                } else {
+                    out << ch;
+                }
+            }
+        }
+    }
+    out << '"';
+}
+
+// Отчет в JSON: массив операций с полными счетчиками
+std::string CopyAudit::Json() const {
+    std::ostringstream out;
+    out << '[';
+    for (size_t i = 0; i < records_.size(); ++i) {
+        const TracerStats& stats = records_[i].stats;
+        if (i > 0) {
+            out << ',';
+        }
+        out << "{\"operation\":";
+        WriteJsonString(out, records_[i].name);
+        out << ",\"default_ctor\":" << stats.default_ctor
+            << ",\"str_ctor\":" << stats.str_ctor
+            << ",\"copy_ctor\":" << stats.copy_ctor
+            << ",\"move_ctor\":" << stats.move_ctor
+            << ",\"copy_assign\":" << stats.copy_assign
+            << ",\"move_assign\":" << stats.move_assign
+            << ",\"dtor\":" << stats.dtor << '}';
+    }
+    out << ']';
+    return out.str();
+}
+
+// Реализация CountingResource
+
+thread_local int64_t CountingResource::thread_allocations_ = 0;
+thread_local int64_t CountingResource::thread_bytes_ = 0;
+
+CountingResource::CountingResource(std::pmr::memory_resource* upstream) : upstream_(upstream) {}
+
+void* CountingResource::do_allocate(size_t bytes, size_t alignment) {
+    void* ptr = upstream_->allocate(bytes, alignment);
+    ++thread_allocations_;
+    thread_bytes_ += static_cast<int64_t>(bytes);
+    return ptr;
+}
+
+void CountingResource::do_deallocate(void* ptr, size_t bytes, size_t alignment) {
+    upstream_->deallocate(ptr, bytes, alignment);
+}
+
+bool CountingResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+int64_t CountingResource::ThreadAllocations() {
+    return thread_allocations_;
+}
+
+int64_t CountingResource::ThreadBytes() {
+    return thread_bytes_;
+}
+
+// Реализация TraceLog
+
+TraceLog::Buffer::Buffer(size_t index, size_t capacity)
+    : events(new TraceEvent[capacity]), capacity(capacity), thread_index(index) {}
+
+// Пишет только поток-владелец: событие сначала записывается,
+// затем публикуется увеличением size
+void TraceLog::Buffer::Push(const TraceEvent& event) {
+    size_t index = size.load(std::memory_order_relaxed);
+    if (index == capacity) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    events[index] = event;
+    size.store(index + 1, std::memory_order_release);
+}
+
+TraceLog& TraceLog::Instance() {
+    static TraceLog log;
+    return log;
+}
+
+TraceLog::Buffer& TraceLog::LocalBuffer() {
+    thread_local Lease lease;
+    return *lease.buffer;
+}
+
+TraceLog::Lease::Lease() : buffer(&Instance().Acquire()) {}
+
+TraceLog::Lease::~Lease() {
+    Instance().Release(*buffer);
+}
+
+// Буфер для нового потока. Буфер завершившегося потока переиспользуется,
+// когда его события уже сброшены (Clear), иначе создается новый. При
+// kMaxBuffers буферах поток получает общий буфер нулевой емкости
+TraceLog::Buffer& TraceLog::Acquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& buffer : buffers_) {
+        if (!buffer->in_use && buffer->size.load(std::memory_order_relaxed) == 0) {
+            buffer->in_use = true;
+            buffer->thread_index = next_thread_index_++;
+            return *buffer;
+        }
+    }
+    if (buffers_.size() == kMaxBuffers) {
+        return overflow_;
+    }
+    buffers_.push_back(std::make_unique<Buffer>(next_thread_index_++, kBufferCapacity));
+    return *buffers_.back();
+}
+
+// Поток завершился: его события остаются в журнале до Clear
+void TraceLog::Release(Buffer& buffer) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    buffer.in_use = false;
+}
+
+int64_t TraceLog::NowNs() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - origin_).count();
+}
+
+int64_t TraceLog::Dropped() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    int64_t dropped = 0;
+    for (const auto& buffer : buffers_) {
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped + overflow_.dropped.load(std::memory_order_relaxed);
+}
+
+// Число созданных буферов (не больше kMaxBuffers)
+size_t TraceLog::Buffers() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return buffers_.size();
+}
+
+// Время в формате trace-event - микросекунды
+std::string TraceLog::ChromeJson() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& buffer : buffers_) {
+        size_t size = buffer->size.load(std::memory_order_acquire);
+        for (size_t i = 0; i < size; ++i) {
+            const TraceEvent& event = buffer->events[i];
+            if (!first) {
+                out << ',';
+            }
+            first = false;
+            out << "{\"name\":";
+            WriteJsonString(out, event.name);
+            out << ",\"ph\":\"X\",\"pid\":1"
+                << ",\"tid\":" << buffer->thread_index
+                << ",\"ts\":" << static_cast<double>(event.start_ns) / 1000.0
+                << ",\"dur\":" << static_cast<double>(event.duration_ns) / 1000.0
+                << ",\"args\":{\"cycles\":" << event.cycles
+                << ",\"allocations\":" << event.allocations
+                << ",\"bytes\":" << event.bytes
+                << ",\"copies\":" << event.copies
+                << ",\"moves\":" << event.moves << "}}";
+        }
+    }
+    out << "],\"displayTimeUnit\":\"ns\"}";
+    return out.str();
+}
+
+void TraceLog::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& buffer : buffers_) {
+        buffer->size.store(0, std::memory_order_relaxed);
+        buffer->dropped.store(0, std::memory_order_relaxed);
+    }
+    overflow_.dropped.store(0, std::memory_order_relaxed);
+}
+
+// Реализация TraceScope
+
+// Такты процессора (на других архитектурах - наносекунды)
+int64_t TraceScope::Cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return static_cast<int64_t>(__rdtsc());
+#else
+    return TraceLog::Instance().NowNs();
+#endif
+}
+
+TraceScope::TraceScope(const char* name)
+    : name_(name),
+      start_ns_(TraceLog::Instance().NowNs()),
+      start_cycles_(Cycles()),
+      start_allocations_(CountingResource::ThreadAllocations()),
+      start_bytes_(CountingResource::ThreadBytes()),
+      start_stats_(Tracer::ThreadStats()) {}
+
+TraceScope::~TraceScope() {
+    int64_t end_cycles = Cycles();
+    int64_t end_ns = TraceLog::Instance().NowNs();
+    TracerStats stats = Tracer::ThreadStats() - start_stats_;
+
+    TraceEvent event;
+    event.name = name_;
+    event.start_ns = start_ns_;
+    event.duration_ns = end_ns - start_ns_;
+    event.cycles = end_cycles - start_cycles_;
+    event.allocations = CountingResource::ThreadAllocations() - start_allocations_;
+    event.bytes = CountingResource::ThreadBytes() - start_bytes_;
+    event.copies = stats.Copies();
+    event.moves = stats.Moves();
+    TraceLog::LocalBuffer().Push(event);
 }
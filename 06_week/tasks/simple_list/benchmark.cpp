@@ -0,0 +1,88 @@
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory_resource>
+#include <string>
+
+#include "simple_list.cpp"
+
+// Источник-счетчик поверх глобальной кучи: сколько раз память
+// действительно запрашивалась у кучи
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t allocations = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// Имитация запроса: список из size коротких строк создается, читается и
+// уничтожается. Короткие строки не выходят за буфер SSO, поэтому вся
+// динамическая память запроса - это узлы списка
+size_t HandleRequest(std::pmr::memory_resource* resource, size_t size) {
+    SimpleList list(resource);
+    for (size_t i = 0; i < size; ++i) {
+        list.PushBack("item");
+    }
+    size_t total = 0;
+    while (!list.Empty()) {
+        total += list.Front().size();
+        list.PopFront();
+    }
+    return total;
+}
+
+// Аргументы - число запросов и размер списка в запросе
+int main(int argc, char** argv) {
+    size_t requests = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000;
+    size_t size = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100;
+
+    std::printf("%zu requests x %zu nodes: heap allocations and ns per request\n", requests, size);
+    std::printf("%12s %14s %12s\n", "resource", "allocations", "ns");
+
+    CountingResource heap;
+    auto run = [&](const char* name, auto make_resource) {
+        size_t allocations_before = heap.allocations;
+        size_t total = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t r = 0; r < requests; ++r) {
+            total += make_resource([&](std::pmr::memory_resource* resource) {
+                return HandleRequest(resource, size);
+            });
+        }
+        auto finish = std::chrono::steady_clock::now();
+        asm volatile("" : : "r"(total) : "memory");
+        double ns = std::chrono::duration<double, std::nano>(finish - start).count();
+        std::printf("%12s %14.2f %12.2f\n", name,
+                    static_cast<double>(heap.allocations - allocations_before) / static_cast<double>(requests),
+                    ns / static_cast<double>(requests));
+    };
+
+    run("heap", [&heap](auto handle) {
+        return handle(&heap);
+    });
+    // Арена на время запроса: буфер на стеке, в кучу - только при переполнении
+    run("monotonic", [&heap](auto handle) {
+        std::array<std::byte, 16384> buffer;
+        std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), &heap);
+        return handle(&arena);
+    });
+    // Пул на весь поток: память узлов переиспользуется между запросами
+    std::pmr::unsynchronized_pool_resource pool(&heap);
+    run("pool", [&pool](auto handle) {
+        return handle(&pool);
+    });
+    return 0;
+}
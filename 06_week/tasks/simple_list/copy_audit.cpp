@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include "simple_list.cpp"
+#include "../../../05_week/tasks/tracer/tracer.cpp"
+
+// Элемент интрузивного списка со значением Tracer
+struct TracedItem : ListHook {
+    Tracer value;
+};
+
+// Интрузивный список не владеет элементами: ни одна операция не копирует
+// и не перемещает Tracer, поэтому в отчете CopyAudit одни нули
+TEST(IntrusiveListCopyAuditTest, OperationsDoNotCopyOrMove) {
+    Tracer::ResetStats();
+    CopyAudit audit;
+    std::vector<TracedItem> items(4);
+    IntrusiveList<TracedItem> list;
+    IntrusiveList<TracedItem> other;
+
+    audit.Run("IntrusiveList push", [&items, &list] {
+        for (TracedItem& item : items) {
+            list.PushBack(item);
+        }
+    });
+    audit.Run("IntrusiveList move ctor", [&list] {
+        IntrusiveList<TracedItem> moved(std::move(list));
+        list = std::move(moved);
+    });
+    audit.Run("IntrusiveList move assign", [&list, &other] {
+        other = std::move(list);
+    });
+    audit.Run("IntrusiveList swap", [&list, &other] {
+        list.Swap(other);
+    });
+    audit.Run("IntrusiveList erase", [&items, &list] {
+        list.Erase(items[1]);
+    });
+
+    EXPECT_EQ(list.Size(), 3);
+    EXPECT_EQ(audit.Table(),
+              "operation                    ctor    copy    move   copy=   move=    dtor\n"
+              "IntrusiveList push              0       0       0       0       0       0\n"
+              "IntrusiveList move ctor         0       0       0       0       0       0\n"
+              "IntrusiveList move assign       0       0       0       0       0       0\n"
+              "IntrusiveList swap              0       0       0       0       0       0\n"
+              "IntrusiveList erase             0       0       0       0       0       0\n");
+    EXPECT_EQ(audit.Json(),
+              "[{\"operation\":\"IntrusiveList push\",\"default_ctor\":0,\"str_ctor\":0,\"copy_ctor\":0,\"move_ctor\":0,\"copy_assign\":0,\"move_assign\":0,\"dtor\":0},"
+              "{\"operation\":\"IntrusiveList move ctor\",\"default_ctor\":0,\"str_ctor\":0,\"copy_ctor\":0,\"move_ctor\":0,\"copy_assign\":0,\"move_assign\":0,\"dtor\":0},"
+              "{\"operation\":\"IntrusiveList move assign\",\"default_ctor\":0,\"str_ctor\":0,\"copy_ctor\":0,\"move_ctor\":0,\"copy_assign\":0,\"move_assign\":0,\"dtor\":0},"
+              "{\"operation\":\"IntrusiveList swap\",\"default_ctor\":0,\"str_ctor\":0,\"copy_ctor\":0,\"move_ctor\":0,\"copy_assign\":0,\"move_assign\":0,\"dtor\":0},"
+              "{\"operation\":\"IntrusiveList erase\",\"default_ctor\":0,\"str_ctor\":0,\"copy_ctor\":0,\"move_ctor\":0,\"copy_assign\":0,\"move_assign\":0,\"dtor\":0}]");
+    list.Clear();
+}
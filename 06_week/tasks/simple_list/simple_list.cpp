@@ -1,29 +1,90 @@
 #include <string>
 #include <cstddef>
 #include <algorithm>
+#include <concepts>
+#include <memory>
+#include <memory_resource>
+
+// Звено двусвязного списка: только указатели, без данных.
+// Используется как база узла SimpleList и как встраиваемый крючок IntrusiveList
+struct ListHook {
+    ListHook* next = nullptr;
+    ListHook* prev = nullptr;
+
+    ListHook() = default;
+    ListHook(const ListHook& other);
+    ListHook& operator=(const ListHook& other);
+
+    bool IsLinked() const;
+    void LinkAfter(ListHook* after_this);
+    void LinkBefore(ListHook* before_this);
+    void Unlink();
+};
+
+// Копия элемента не входит ни в какой список: звенья не копируются,
+// иначе копия указывала бы на соседей чужого списка
+ListHook::ListHook(const ListHook&) {}
+
+// Присваивание не меняет привязку звена к его собственному списку
+ListHook& ListHook::operator=(const ListHook&) {
+    return *this;
+}
+
+// Проверка, привязано ли звено к какому-либо списку
+bool ListHook::IsLinked() const {
+    return next != nullptr;
+}
+
+// Вставляет звено после указанного
+void ListHook::LinkAfter(ListHook* after_this) {
+    prev = after_this;
+    next = after_this->next;
+    after_this->next->prev = this;
+    after_this->next = this;
+}
+
+// Вставляет звено перед указанным
+void ListHook::LinkBefore(ListHook* before_this) {
+    LinkAfter(before_this->prev);
+}
+
+// Вывязывает звено из списка, перевязывая соседей друг на друга
+void ListHook::Unlink() {
+    prev->next = next;
+    next->prev = prev;
+    next = nullptr;
+    prev = nullptr;
+}
 
 class SimpleList {
 private:
-    struct Node {
+    struct Node : ListHook {
         std::string data;
-        Node* next;
-        Node* prev;
         
         Node(const std::string& value);
         Node(std::string&& value);
     };
     
-    Node* head;   // фиктивный узел (sentinel)
-    size_t count; // количество элементов
+    ListHook head; // фиктивное звено (sentinel) хранится прямо в списке
+    size_t count;  // количество элементов
+    std::pmr::memory_resource* resource; // источник памяти для узлов
+    
+    template<typename Value>
+    Node* CreateNode(Value&& value);
+    void DestroyNode(Node* node);
+    void Reset();
+    void Adopt(SimpleList& other);
     
     void Unlink(Node* node);
-    void LinkAfter(Node* new_node, Node* after_this);
-    void LinkBefore(Node* new_node, Node* before_this);
+    void LinkAfter(Node* new_node, ListHook* after_this);
+    void LinkBefore(Node* new_node, ListHook* before_this);
     
 public:
 
     // Конструкторы
     SimpleList();
+    explicit SimpleList(std::pmr::memory_resource* resource);
+    SimpleList(const SimpleList& other, std::pmr::memory_resource* resource);
     SimpleList(const SimpleList& other);
     SimpleList(SimpleList&& other) noexcept;
 
@@ -38,6 +99,7 @@ public:
     void Swap(SimpleList& other) noexcept;
     size_t Size() const;
     bool Empty() const;
+    std::pmr::memory_resource* Resource() const;
 
     void PushBack(const std::string& value);
     void PushBack(std::string&& value);
@@ -61,71 +123,111 @@ void Swap(SimpleList& lhs, SimpleList& rhs) noexcept;
 
 // Конструкторы узла
 SimpleList::Node::Node(const std::string& value) 
-    : data(value), next(nullptr), prev(nullptr) {}
+    : data(value) {}
 
 SimpleList::Node::Node(std::string&& value) 
-    : data(std::move(value)), next(nullptr), prev(nullptr) {}
+    : data(std::move(value)) {}
     
 
 // Приватные вспомогательные методы
 
+// Создает узел в памяти из источника списка
+template<typename Value>
+SimpleList::Node* SimpleList::CreateNode(Value&& value) {
+    void* memory = resource->allocate(sizeof(Node), alignof(Node));
+    try {
+        return ::new (memory) Node(std::forward<Value>(value));
+    } catch (...) {
+        resource->deallocate(memory, sizeof(Node), alignof(Node));
+        throw;
+    }
+}
+
+// Уничтожает узел и возвращает память источнику
+void SimpleList::DestroyNode(Node* node) {
+    std::destroy_at(node);
+    resource->deallocate(node, sizeof(Node), alignof(Node));
+}
+
+// Делает список пустым, замыкая фиктивное звено на себя
+void SimpleList::Reset() {
+    head.next = &head;
+    head.prev = &head;
+    count = 0;
+}
+
+// Забирает узлы другого списка, перевязывая их на своё фиктивное звено.
+// Память не выделяется, поэтому перемещение не бросает исключений
+void SimpleList::Adopt(SimpleList& other) {
+    resource = other.resource;
+    if (other.Empty()) {
+        Reset();
+        return;
+    }
+    head.next = other.head.next;
+    head.prev = other.head.prev;
+    head.next->prev = &head;
+    head.prev->next = &head;
+    count = other.count;
+    other.Reset();
+}
+
 // Удаляет узел из списка
 void SimpleList::Unlink(Node* node) {
-    node->prev->next = node->next;
-    node->next->prev = node->prev;
-    delete node;
+    node->Unlink();
+    DestroyNode(node);
     --count;
 }
 
 // Вставляет узел после указанного
-void SimpleList::LinkAfter(Node* new_node, Node* after_this) {
-    new_node->prev = after_this;
-    new_node->next = after_this->next;
-    after_this->next->prev = new_node;
-    after_this->next = new_node;
+void SimpleList::LinkAfter(Node* new_node, ListHook* after_this) {
+    new_node->LinkAfter(after_this);
     ++count;
 }
 
 // Вставляет узел перед указанным
-void SimpleList::LinkBefore(Node* new_node, Node* before_this) {
+void SimpleList::LinkBefore(Node* new_node, ListHook* before_this) {
     LinkAfter(new_node, before_this->prev);
 }
 
 // Конструктор по умолчанию
-SimpleList::SimpleList() : count(0) {
-    head = new Node(std::string());
-    head->next = head;
-    head->prev = head;
+SimpleList::SimpleList() : SimpleList(std::pmr::get_default_resource()) {}
+
+// Конструктор с источником памяти (например, аренда на время запроса)
+SimpleList::SimpleList(std::pmr::memory_resource* resource) 
+    : count(0), resource(resource) {
+    Reset();
 }
 
-// Копирующий конструктор
-SimpleList::SimpleList(const SimpleList& other) : SimpleList() {
-    Node* current = other.head->next;
-    while (current != other.head) {
-        PushBack(current->data);
+// Копирующий конструктор. Как и у std::pmr контейнеров, копия не наследует
+// источник памяти оригинала
+SimpleList::SimpleList(const SimpleList& other)
+    : SimpleList(other, std::pmr::get_default_resource()) {}
+
+// Копирующий конструктор в указанный источник памяти
+SimpleList::SimpleList(const SimpleList& other, std::pmr::memory_resource* resource)
+    : SimpleList(resource) {
+    const ListHook* current = other.head.next;
+    while (current != &other.head) {
+        PushBack(static_cast<const Node*>(current)->data);
         current = current->next;
     }
 }
 
 // Перемещающий конструктор
-SimpleList::SimpleList(SimpleList&& other) noexcept 
-    : head(other.head), count(other.count) {
-    other.head = new Node(std::string());
-    other.head->next = other.head;
-    other.head->prev = other.head;
-    other.count = 0;
+SimpleList::SimpleList(SimpleList&& other) noexcept {
+    Adopt(other);
 }
 
 // Деструктор
 SimpleList::~SimpleList() {
     Clear();
-    delete head;
 }
 
-// Копирующее присваивание
+// Копирующее присваивание (источник памяти не меняется)
 SimpleList& SimpleList::operator=(const SimpleList& other) {
     if (this != &other) {
-        SimpleList temp(other);
+        SimpleList temp(other, resource);
         Swap(temp);
     }
     return *this;
@@ -135,23 +237,18 @@ SimpleList& SimpleList::operator=(const SimpleList& other) {
 SimpleList& SimpleList::operator=(SimpleList&& other) noexcept {
     if (this != &other) {
         Clear();
-        delete head;
-        
-        head = other.head;
-        count = other.count;
-        
-        other.head = new Node(std::string());
-        other.head->next = other.head;
-        other.head->prev = other.head;
-        other.count = 0;
+        Adopt(other);
     }
     return *this;
 }
 
 // Обмен содержимым с другим списком
 void SimpleList::Swap(SimpleList& other) noexcept {
-    std::swap(head, other.head);
-    std::swap(count, other.count);
+    if (this != &other) {
+        SimpleList temp(std::move(other));
+        other.Adopt(*this);
+        Adopt(temp);
+    }
 }
 
 // Получение размера списка
@@ -164,39 +261,44 @@ bool SimpleList::Empty() const {
     return count == 0;
 }
 
+// Источник памяти для узлов
+std::pmr::memory_resource* SimpleList::Resource() const {
+    return resource;
+}
+
 // Вставка в конец
 void SimpleList::PushBack(const std::string& value) {
-    Node* new_node = new Node(value);
-    LinkBefore(new_node, head);
+    Node* new_node = CreateNode(value);
+    LinkBefore(new_node, &head);
 }
 
 void SimpleList::PushBack(std::string&& value) {
-    Node* new_node = new Node(std::move(value));
-    LinkBefore(new_node, head);
+    Node* new_node = CreateNode(std::move(value));
+    LinkBefore(new_node, &head);
 }
 
 // Удаление последнего элемента
 void SimpleList::PopBack() {
     if (!Empty()) {
-        Unlink(head->prev);
+        Unlink(static_cast<Node*>(head.prev));
     }
 }
 
 // Вставка в начало
 void SimpleList::PushFront(const std::string& value) {
-    Node* new_node = new Node(value);
-    LinkAfter(new_node, head);
+    Node* new_node = CreateNode(value);
+    LinkAfter(new_node, &head);
 }
 
 void SimpleList::PushFront(std::string&& value) {
-    Node* new_node = new Node(std::move(value));
-    LinkAfter(new_node, head);
+    Node* new_node = CreateNode(std::move(value));
+    LinkAfter(new_node, &head);
 }
 
 // Удаление первого элемента
 void SimpleList::PopFront() {
     if (!Empty()) {
-        Unlink(head->next);
+        Unlink(static_cast<Node*>(head.next));
     }
 }
 
@@ -209,23 +311,377 @@ void SimpleList::Clear() {
 
 // Доступ к первому элементу
 std::string& SimpleList::Front() {
-    return head->next->data;
+    return static_cast<Node*>(head.next)->data;
 }
 
 const std::string& SimpleList::Front() const {
-    return head->next->data;
+    return static_cast<const Node*>(head.next)->data;
 }
 
 // Доступ к последнему элементу
 std::string& SimpleList::Back() {
-    return head->prev->data;
+    return static_cast<Node*>(head.prev)->data;
 }
 
 const std::string& SimpleList::Back() const {
-    return head->prev->data;
+    return static_cast<const Node*>(head.prev)->data;
 }
 
 // Свободная функция swap
 void Swap(SimpleList& lhs, SimpleList& rhs) noexcept {
     lhs.Swap(rhs);
-}
\ No newline at end of file
+}
+
+// Интрузивный двусвязный список: элементы сами содержат звено (наследуют ListHook),
+// поэтому вставка и удаление не выделяют память. Список не владеет элементами
+template<typename T>
+requires std::derived_from<T, ListHook>
+class IntrusiveList {
+private:
+    ListHook head_; // фиктивное звено (sentinel) хранится прямо в списке
+    size_t count_;  // количество элементов
+
+    void Reset();
+    void Adopt(IntrusiveList& other);
+
+public:
+    class Iterator {
+    private:
+        ListHook* node_;
+
+    public:
+        explicit Iterator(ListHook* node);
+
+        T& operator*() const;
+        T* operator->() const;
+        Iterator& operator++();
+        Iterator& operator--();
+        bool operator==(const Iterator& other) const = default;
+    };
+
+    class ConstIterator {
+    private:
+        const ListHook* node_;
+
+    public:
+        explicit ConstIterator(const ListHook* node);
+
+        const T& operator*() const;
+        const T* operator->() const;
+        ConstIterator& operator++();
+        ConstIterator& operator--();
+        bool operator==(const ConstIterator& other) const = default;
+    };
+
+    // Конструкторы
+    IntrusiveList();
+    IntrusiveList(const IntrusiveList& other) = delete;
+    IntrusiveList(IntrusiveList&& other) noexcept;
+
+    // Деструктор
+    ~IntrusiveList();
+
+    // Операторы
+    IntrusiveList& operator=(const IntrusiveList& other) = delete;
+    IntrusiveList& operator=(IntrusiveList&& other) noexcept;
+
+    // Методы
+    void Swap(IntrusiveList& other) noexcept;
+    size_t Size() const;
+    bool Empty() const;
+
+    void PushBack(T& value);
+    void PopBack();
+
+    void PushFront(T& value);
+    void PopFront();
+
+    void InsertAfter(T& pos, T& value);
+    void InsertBefore(T& pos, T& value);
+    void Erase(T& value);
+
+    void Clear();
+
+    T& Front();
+    const T& Front() const;
+
+    T& Back();
+    const T& Back() const;
+
+    // Итераторы
+    Iterator begin();
+    Iterator end();
+    ConstIterator begin() const;
+    ConstIterator end() const;
+};
+
+// Итератор
+template<typename T>
+requires std::derived_from<T, ListHook>
+IntrusiveList<T>::Iterator::Iterator(ListHook* node) : node_(node) {}
+
+template<typename T>
+requires std::derived_from<T, ListHook>
+T& IntrusiveList<T>::Iterator::operator*() const {
+    return *static_cast<T*>(node_);
+}
+
+template<typename T>
+requires std::derived_from<T, ListHook>
+T* IntrusiveList<T>::Iterator::operator->() const {
+    return static_cast<T*>(node_);
+}
+
+template<typename T>
+requires std::derived_from<T, ListHook>
+typename IntrusiveList<T>::Iterator& IntrusiveList<T>::Iterator::operator++() {
+    node_ = node_->next;
+    return *this;
+}
+
+template<typename T>
+requires std::derived_from<T, ListHook>
+typename IntrusiveList<T>::Iterator& IntrusiveList<T>::Iterator::operator--() {
+    node_ = node_->prev;
+    return *this;
+}
+
+// Константный итератор
+template<typename T>
+requires std::derived_from<T, ListHook>
+IntrusiveList<T>::ConstIterator::ConstIterator(const ListHook* node) : node_(node) {}
+
+template<typename T>
+requires std::derived_from<T, ListHook>
+const T& IntrusiveList<T>::ConstIterator::operator*() const {
+    return *static_cast<const T*>(node_);
+}
+
+template<typename T>
+requires std::derived_from<T, ListHook>
+const T* IntrusiveList<T>::ConstIterator::operator->() const {
+    return static_cast<const T*>(node_);
+}
+
+template<typename T>
+requires std::derived_from<T, ListHook>
+typename IntrusiveList<T>::ConstIterator& IntrusiveList<T>::ConstIterator::operator++() {
+    node_ = node_->next;
+    return *this;
+}
+
+template<typename T>
+requires std::derived_from<T, ListHook>
+typename IntrusiveList<T>::ConstIterator& IntrusiveList<T>::ConstIterator::operator--() {
+    node_ = node_->prev;
+    return *this;
+}
+
+// Приватные вспомогательные методы
+
+// Делает список пустым, замыкая фиктивное звено на себя
+template<typename T>
+requires std::derived_from<T, ListHook>
+void IntrusiveList<T>::Reset() {
+    head_.next = &head_;
+    head_.prev = &head_;
+    count_ = 0;
+}
+
+// Забирает элементы другого списка, перевязывая их на своё фиктивное звено
+template<typename T>
+requires std::derived_from<T, ListHook>
+void IntrusiveList<T>::Adopt(IntrusiveList& other) {
+    if (other.Empty()) {
+        Reset();
+        return;
+    }
+    head_.next = other.head_.next;
+    head_.prev = other.head_.prev;
+    head_.next->prev = &head_;
+    head_.prev->next = &head_;
+    count_ = other.count_;
+    other.Reset();
+}
+
+// Конструктор по умолчанию
+template<typename T>
+requires std::derived_from<T, ListHook>
+IntrusiveList<T>::IntrusiveList() {
+    Reset();
+}
+
+// Перемещающий конструктор
+template<typename T>
+requires std::derived_from<T, ListHook>
+IntrusiveList<T>::IntrusiveList(IntrusiveList&& other) noexcept {
+    Adopt(other);
+}
+
+// Деструктор: отвязывает элементы, но не уничтожает их
+template<typename T>
+requires std::derived_from<T, ListHook>
+IntrusiveList<T>::~IntrusiveList() {
+    Clear();
+}
+
+// Перемещающее присваивание
+template<typename T>
+requires std::derived_from<T, ListHook>
+IntrusiveList<T>& IntrusiveList<T>::operator=(IntrusiveList&& other) noexcept {
+    if (this != &other) {
+        Clear();
+        Adopt(other);
+    }
+    return *this;
+}
+
+// Обмен содержимым с другим списком
+template<typename T>
+requires std::derived_from<T, ListHook>
+void IntrusiveList<T>::Swap(IntrusiveList& other) noexcept {
+    if (this != &other) {
+        IntrusiveList temp(std::move(other));
+        other.Adopt(*this);
+        Adopt(temp);
+    }
+}
+
+// Получение размера списка
+template<typename T>
+requires std::derived_from<T, ListHook>
+size_t IntrusiveList<T>::Size() const {
+    return count_;
+}
+
+// Проверка, пуст ли список
+template<typename T>
+requires std::derived_from<T, ListHook>
+bool IntrusiveList<T>::Empty() const {
+    return count_ == 0;
+}
+
+// Вставка в конец
+template<typename T>
+requires std::derived_from<T, ListHook>
+void IntrusiveList<T>::PushBack(T& value) {
+    value.LinkBefore(&head_);
+    ++count_;
+}
+
+// Удаление последнего элемента
+template<typename T>
+requires std::derived_from<T, ListHook>
+void IntrusiveList<T>::PopBack() {
+    if (!Empty()) {
+        Erase(Back());
+    }
+}
+
+// Вставка в начало
+template<typename T>
+requires std::derived_from<T, ListHook>
+void IntrusiveList<T>::PushFront(T& value) {
+    value.LinkAfter(&head_);
+    ++count_;
+}
+
+// Удаление первого элемента
+template<typename T>
+requires std::derived_from<T, ListHook>
+void IntrusiveList<T>::PopFront() {
+    if (!Empty()) {
+        Erase(Front());
+    }
+}
+
+// Вставка после элемента, уже находящегося в этом списке
+template<typename T>
+requires std::derived_from<T, ListHook>
+void IntrusiveList<T>::InsertAfter(T& pos, T& value) {
+    value.LinkAfter(&pos);
+    ++count_;
+}
+
+// Вставка перед элементом, уже находящимся в этом списке
+template<typename T>
+requires std::derived_from<T, ListHook>
+void IntrusiveList<T>::InsertBefore(T& pos, T& value) {
+    value.LinkBefore(&pos);
+    ++count_;
+}
+
+// Удаление элемента этого списка по ссылке за O(1)
+template<typename T>
+requires std::derived_from<T, ListHook>
+void IntrusiveList<T>::Erase(T& value) {
+    value.Unlink();
+    --count_;
+}
+
+// Очистка списка: все элементы отвязываются и могут быть вставлены снова
+template<typename T>
+requires std::derived_from<T, ListHook>
+void IntrusiveList<T>::Clear() {
+    while (!Empty()) {
+        PopFront();
+    }
+}
+
+// Доступ к первому элементу
+template<typename T>
+requires std::derived_from<T, ListHook>
+T& IntrusiveList<T>::Front() {
+    return *static_cast<T*>(head_.next);
+}
+
+template<typename T>
+requires std::derived_from<T, ListHook>
+const T& IntrusiveList<T>::Front() const {
+    return *static_cast<const T*>(head_.next);
+}
+
+// Доступ к последнему элементу
+template<typename T>
+requires std::derived_from<T, ListHook>
+T& IntrusiveList<T>::Back() {
+    return *static_cast<T*>(head_.prev);
+}
+
+template<typename T>
+requires std::derived_from<T, ListHook>
+const T& IntrusiveList<T>::Back() const {
+    return *static_cast<const T*>(head_.prev);
+}
+
+// Итераторы
+template<typename T>
+requires std::derived_from<T, ListHook>
+typename IntrusiveList<T>::Iterator IntrusiveList<T>::begin() {
+    return Iterator(head_.next);
+}
+
+template<typename T>
+requires std::derived_from<T, ListHook>
+typename IntrusiveList<T>::Iterator IntrusiveList<T>::end() {
+    return Iterator(&head_);
+}
+
+template<typename T>
+requires std::derived_from<T, ListHook>
+typename IntrusiveList<T>::ConstIterator IntrusiveList<T>::begin() const {
+    return ConstIterator(head_.next);
+}
+
+template<typename T>
+requires std::derived_from<T, ListHook>
+typename IntrusiveList<T>::ConstIterator IntrusiveList<T>::end() const {
+    return ConstIterator(&head_);
+}
+
+// Свободная функция swap
+template<typename T>
+requires std::derived_from<T, ListHook>
+void Swap(IntrusiveList<T>& lhs, IntrusiveList<T>& rhs) noexcept {
+    lhs.Swap(rhs);
+}
@@ -1,4 +1,8 @@
 #include <gtest/gtest.h>
+#include <array>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
 
 #include "simple_list.cpp"
 
@@ -667,4 +671,177 @@ TEST(SimpleListTest, CopyAfterModifications) {
     EXPECT_EQ(list2.Size(), 2);
     EXPECT_EQ(list2.Front(), "a");
     EXPECT_EQ(list2.Back(), "b");
-}
\ No newline at end of file
+}
+
+struct Item : ListHook {
+    int value;
+
+    explicit Item(int v) : value(v) {}
+};
+
+TEST(IntrusiveListTest, PushAndPop) {
+    Item a(1), b(2), c(3);
+    IntrusiveList<Item> list;
+    EXPECT_TRUE(list.Empty());
+
+    list.PushBack(b);
+    list.PushBack(c);
+    list.PushFront(a);
+
+    EXPECT_EQ(list.Size(), 3);
+    EXPECT_EQ(&list.Front(), &a);
+    EXPECT_EQ(&list.Back(), &c);
+    EXPECT_TRUE(b.IsLinked());
+
+    list.PopFront();
+    EXPECT_FALSE(a.IsLinked());
+    EXPECT_EQ(&list.Front(), &b);
+
+    list.PopBack();
+    EXPECT_FALSE(c.IsLinked());
+    EXPECT_EQ(list.Size(), 1);
+    EXPECT_EQ(&list.Back(), &b);
+}
+
+TEST(IntrusiveListTest, EraseByReference) {
+    Item a(1), b(2), c(3);
+    IntrusiveList<Item> list;
+    list.PushBack(a);
+    list.PushBack(b);
+    list.PushBack(c);
+
+    list.Erase(b);
+
+    EXPECT_EQ(list.Size(), 2);
+    EXPECT_FALSE(b.IsLinked());
+    EXPECT_EQ(&list.Front(), &a);
+    EXPECT_EQ(&list.Back(), &c);
+
+    list.InsertAfter(a, b);
+    std::vector<int> values;
+    for (Item& item : list) {
+        values.push_back(item.value);
+    }
+    EXPECT_EQ(values, std::vector<int>({1, 2, 3}));
+}
+
+TEST(IntrusiveListTest, MoveAndSwap) {
+    Item a(1), b(2), c(3);
+    IntrusiveList<Item> list1;
+    list1.PushBack(a);
+    list1.PushBack(b);
+
+    IntrusiveList<Item> list2(std::move(list1));
+    EXPECT_TRUE(list1.Empty());
+    EXPECT_EQ(list2.Size(), 2);
+    EXPECT_EQ(&list2.Back(), &b);
+
+    list1.PushBack(c);
+    Swap(list1, list2);
+    EXPECT_EQ(list1.Size(), 2);
+    EXPECT_EQ(&list1.Front(), &a);
+    EXPECT_EQ(list2.Size(), 1);
+    EXPECT_EQ(&list2.Front(), &c);
+
+    list2 = std::move(list1);
+    EXPECT_FALSE(c.IsLinked());
+    EXPECT_EQ(list2.Size(), 2);
+    list2.Clear();
+    EXPECT_FALSE(a.IsLinked());
+    EXPECT_FALSE(b.IsLinked());
+}
+
+TEST(IntrusiveListTest, CopiedElementIsUnlinked) {
+    Item a(1), b(2);
+    IntrusiveList<Item> list;
+    list.PushBack(a);
+    list.PushBack(b);
+
+    Item copy = a;
+    EXPECT_FALSE(copy.IsLinked());
+    EXPECT_EQ(copy.value, 1);
+
+    Item other(5);
+    other = b;
+    EXPECT_FALSE(other.IsLinked());
+    EXPECT_EQ(other.value, 2);
+
+    a = other;
+    EXPECT_TRUE(a.IsLinked());
+    EXPECT_EQ(list.Size(), 2);
+    EXPECT_EQ(&list.Front(), &a);
+    list.Clear();
+}
+
+TEST(IntrusiveListTest, ConstIteration) {
+    Item a(1), b(2), c(3);
+    IntrusiveList<Item> list;
+    list.PushBack(a);
+    list.PushBack(b);
+    list.PushBack(c);
+
+    const IntrusiveList<Item>& view = list;
+    std::vector<int> values;
+    for (const Item& item : view) {
+        values.push_back(item.value);
+    }
+    EXPECT_EQ(values, std::vector<int>({1, 2, 3}));
+    EXPECT_EQ(view.begin()->value, 1);
+    list.Clear();
+}
+
+TEST(SimpleListTest, MemoryResource) {
+    std::array<std::byte, 1024> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                              std::pmr::null_memory_resource());
+    SimpleList list(&arena);
+    EXPECT_EQ(list.Resource(), &arena);
+    list.PushBack("first");
+    list.PushFront("zero");
+    EXPECT_EQ(list.Front(), "zero");
+    EXPECT_EQ(list.Back(), "first");
+
+    SimpleList moved = std::move(list);
+    EXPECT_EQ(moved.Resource(), &arena);
+    EXPECT_EQ(moved.Size(), 2);
+
+    // Узлы берутся только из арены: когда буфер кончается, вставка падает
+    EXPECT_THROW({
+        for (int i = 0; i < 1000; ++i) {
+            moved.PushBack("x");
+        }
+    }, std::bad_alloc);
+
+    SimpleList copy = moved;
+    EXPECT_EQ(copy.Resource(), std::pmr::get_default_resource());
+    EXPECT_EQ(copy.Size(), moved.Size());
+}
+
+TEST(SimpleListTest, MoveFromExhaustedArena) {
+    std::array<std::byte, 512> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                              std::pmr::null_memory_resource());
+    SimpleList list(&arena);
+    EXPECT_THROW({
+        for (int i = 0; i < 100; ++i) {
+            list.PushBack("x");
+        }
+    }, std::bad_alloc);
+    size_t size = list.Size();
+
+    // Арена исчерпана, но перемещение и обмен не выделяют память
+    static_assert(std::is_nothrow_move_constructible_v<SimpleList>);
+    SimpleList moved = std::move(list);
+    EXPECT_EQ(moved.Size(), size);
+    EXPECT_TRUE(list.Empty());
+
+    SimpleList target(&arena);
+    target = std::move(moved);
+    EXPECT_EQ(target.Size(), size);
+    EXPECT_TRUE(moved.Empty());
+
+    target.Swap(list);
+    EXPECT_EQ(list.Size(), size);
+    EXPECT_TRUE(target.Empty());
+    EXPECT_EQ(list.Back(), "x");
+}
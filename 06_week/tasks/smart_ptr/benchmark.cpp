@@ -0,0 +1,222 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "smart_ptr.cpp"
+
+// Счетчик вызовов глобального operator new
+std::atomic<size_t> allocation_count{0};
+
+void* operator new(size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+// Время выполнения body в наносекундах на одну из operations операций
+template<typename Body>
+double NanosecondsPerOperation(size_t operations, Body body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(finish - start).count() / static_cast<double>(operations);
+}
+
+// Запуск task(t) в threads потоках и ожидание их завершения
+template<typename Task>
+void RunThreads(size_t threads, Task task) {
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back(task, t);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+// Конкуренция за счетчики: каждый поток iterations раз копирует и уничтожает
+// SharedPtr. В режиме shared все потоки работают с одним блоком управления,
+// в режиме private - каждый со своим, то есть без конкуренции
+void BenchmarkContention(size_t iterations) {
+    std::printf("SharedPtr copy+destroy, ns/op\n");
+    std::printf("%8s %12s %12s\n", "threads", "shared", "private");
+
+    const size_t max_threads = std::max<size_t>(std::thread::hardware_concurrency(), 4);
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        SharedPtr common = MakeShared("value");
+        std::vector<SharedPtr> owned;
+        for (size_t t = 0; t < threads; ++t) {
+            owned.push_back(MakeShared("value"));
+        }
+
+        auto copy_loop = [iterations](const SharedPtr& source) {
+            for (size_t i = 0; i < iterations; ++i) {
+                SharedPtr copy(source);
+                asm volatile("" : : "r"(copy.Get()) : "memory");
+            }
+        };
+        double shared_ns = NanosecondsPerOperation(iterations * threads, [&] {
+            RunThreads(threads, [&](size_t) { copy_loop(common); });
+        });
+        double private_ns = NanosecondsPerOperation(iterations * threads, [&] {
+            RunThreads(threads, [&](size_t t) { copy_loop(owned[t]); });
+        });
+        std::printf("%8zu %12.2f %12.2f\n", threads, shared_ns, private_ns);
+    }
+}
+
+// Аллокации и разыменование: count указателей создаются через MakeShared
+// (объект и блок в одной аллокации) и через конструктор от new (две аллокации).
+// Затем указатели обходятся в случайном порядке: время разыменования включает
+// промахи кеша по блоку и объекту
+void BenchmarkMakeShared(size_t count) {
+    std::printf("\n%zu pointers: allocations, create ns/op, dereference ns/op\n", count);
+    std::printf("%12s %12s %12s %12s\n", "method", "allocations", "create", "dereference");
+
+    std::vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+    auto run = [&](const char* name, auto create) {
+        std::vector<SharedPtr> pointers;
+        pointers.reserve(count);
+        size_t allocations_before = allocation_count.load();
+        double create_ns = NanosecondsPerOperation(count, [&] {
+            for (size_t i = 0; i < count; ++i) {
+                pointers.push_back(create());
+            }
+        });
+        size_t allocations = allocation_count.load() - allocations_before;
+
+        size_t total = 0;
+        double dereference_ns = NanosecondsPerOperation(count, [&] {
+            for (size_t index : order) {
+                SharedPtr copy(pointers[index]);
+                total += copy->size();
+            }
+        });
+        asm volatile("" : : "r"(total) : "memory");
+        std::printf("%12s %12.2f %12.2f %12.2f\n", name,
+                    static_cast<double>(allocations) / static_cast<double>(count), create_ns, dereference_ns);
+    };
+    run("MakeShared", [] { return MakeShared("value"); });
+    run("new", [] { return SharedPtr(new std::string("value")); });
+}
+
+// Один писатель и readers читателей: каждый читатель iterations раз получает
+// текущий снимок, писатель все это время публикует новые. Сравнивается
+// AtomicSharedPtr и SharedPtr под мьютексом
+void BenchmarkReaders(size_t iterations) {
+    std::printf("\nreaders + 1 writer, read ns/op\n");
+    std::printf("%8s %12s %12s\n", "readers", "atomic", "mutex");
+
+    const size_t max_threads = std::max<size_t>(std::thread::hardware_concurrency(), 4);
+    for (size_t readers = 1; readers <= max_threads; readers *= 2) {
+        auto run = [&](auto load, auto store) {
+            std::atomic<size_t> active{readers};
+            std::thread writer([&] {
+                while (active.load(std::memory_order_relaxed) != 0) {
+                    store(MakeShared("snapshot"));
+                }
+            });
+            double ns = NanosecondsPerOperation(iterations * readers, [&] {
+                RunThreads(readers, [&](size_t) {
+                    size_t total = 0;
+                    for (size_t i = 0; i < iterations; ++i) {
+                        total += load()->size();
+                    }
+                    asm volatile("" : : "r"(total) : "memory");
+                    active.fetch_sub(1, std::memory_order_relaxed);
+                });
+            });
+            writer.join();
+            return ns;
+        };
+
+        AtomicSharedPtr<std::string> slot(MakeShared("snapshot"));
+        double atomic_ns = run([&] { return slot.Load(); },
+                               [&](SharedPtr value) { slot.Store(std::move(value)); });
+
+        std::mutex mutex;
+        SharedPtr guarded = MakeShared("snapshot");
+        double mutex_ns = run([&] {
+                                  std::lock_guard lock(mutex);
+                                  return guarded;
+                              },
+                              [&](SharedPtr value) {
+                                  std::lock_guard lock(mutex);
+                                  guarded.Swap(value);
+                              });
+        std::printf("%8zu %12.2f %12.2f\n", readers, atomic_ns, mutex_ns);
+    }
+}
+
+// Чтение общего объекта: каждый из threads потоков iterations раз входит в
+// эпоху через EpochReader и разыменовывает текущий указатель, либо копирует
+// общий SharedPtr и разыменовывает копию. Вход в эпоху пишет только в запись
+// своего потока, копия SharedPtr - в общий счетчик ссылок
+void BenchmarkEpochReaders(size_t iterations) {
+    std::printf("\nshared object reads, ns/read\n");
+    std::printf("%8s %12s %12s\n", "threads", "epoch", "SharedPtr");
+
+    const size_t max_threads = std::max<size_t>(std::thread::hardware_concurrency(), 4);
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        SharedPtr common = MakeShared("value");
+        EpochDomain domain;
+        std::atomic<std::string*> current{common.Get()};
+
+        double epoch_ns = NanosecondsPerOperation(iterations * threads, [&] {
+            RunThreads(threads, [&](size_t) {
+                EpochReader reader(domain);
+                size_t total = 0;
+                for (size_t i = 0; i < iterations; ++i) {
+                    auto guard = reader.Pin();
+                    total += current.load(std::memory_order_acquire)->size();
+                }
+                asm volatile("" : : "r"(total) : "memory");
+            });
+        });
+        double shared_ns = NanosecondsPerOperation(iterations * threads, [&] {
+            RunThreads(threads, [&](size_t) {
+                size_t total = 0;
+                for (size_t i = 0; i < iterations; ++i) {
+                    SharedPtr copy(common);
+                    total += copy->size();
+                }
+                asm volatile("" : : "r"(total) : "memory");
+            });
+        });
+        std::printf("%8zu %12.2f %12.2f\n", threads, epoch_ns, shared_ns);
+    }
+}
+
+// Аргумент - число итераций на поток
+int main(int argc, char** argv) {
+    size_t iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+
+    BenchmarkContention(iterations);
+    BenchmarkMakeShared(iterations);
+    BenchmarkReaders(iterations);
+    BenchmarkEpochReaders(iterations);
+    return 0;
+}
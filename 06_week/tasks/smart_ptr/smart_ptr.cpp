@@ -1,149 +1,414 @@
 #include <string>
 #include <cstddef>
 #include <utility>
+#include <atomic>
+#include <memory>
+#include <concepts>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 // Предварительные объявления классов
-class SharedPtr;
-class WeakPtr;
+template<typename T>
+class BasicSharedPtr;
+template<typename T>
+class BasicWeakPtr;
+template<typename T>
+class AtomicSharedPtr;
 
-// Класс ControlBlock - управляющий блок для подсчета ссылок
+// Удалитель по умолчанию - обычный delete
+template<typename T>
+struct DefaultDelete {
+    void operator()(T* ptr) const;
+};
+
+template<typename T>
+void DefaultDelete<T>::operator()(T* ptr) const {
+    delete ptr;
+}
+
+// Класс ControlBlock - управляющий блок для подсчета ссылок.
+// Счетчики атомарные, поэтому копии SharedPtr/WeakPtr можно передавать в другие потоки.
+// Все владельцы вместе удерживают одну дополнительную слабую ссылку: блок удаляется
+// ровно одним потоком - тем, кто обнулил weak_count_.
+// Блок не знает тип объекта: способ уничтожения объекта и освобождения памяти
+// самого блока определяют наследники через DestroyObject/DestroyBlock
 class ControlBlock {
 private:
-    std::string* ptr_;
-    size_t shared_count_;
-    size_t weak_count_;
+    std::atomic<size_t> shared_count_;
+    std::atomic<size_t> weak_count_;
+
+    virtual void DestroyObject() = 0;
+    virtual void DestroyBlock() = 0;
+
+protected:
+    virtual ~ControlBlock() = default;
 
 public:
-    explicit ControlBlock(std::string* ptr);
-    
+    ControlBlock();
+
     void IncrementShared();
+    bool TryIncrementShared();
     void DecrementShared();
     void IncrementWeak();
     void DecrementWeak();
-    
+
     size_t GetSharedCount() const;
     size_t GetWeakCount() const;
-    std::string* GetPtr() const;
 };
 
 // Конструктор ControlBlock
-ControlBlock::ControlBlock(std::string* ptr) 
-    : ptr_(ptr), shared_count_(1), weak_count_(0) {}
+ControlBlock::ControlBlock()
+    : shared_count_(1), weak_count_(1) {}
 
-// Увеличить счетчик владельцев
-void ControlBlock::IncrementShared() { 
-    ++shared_count_; 
+// Увеличить счетчик владельцев. Вызывающий уже владеет объектом,
+// поэтому счетчик не может обнулиться и порядок памяти не важен
+void ControlBlock::IncrementShared() {
+    shared_count_.fetch_add(1, std::memory_order_relaxed);
 }
 
-// Уменьшить счетчик владельцев и удалить объект/блок при необходимости
-void ControlBlock::DecrementShared() { 
-    --shared_count_; 
-    if (shared_count_ == 0) {
-        delete ptr_;                    // удаляем управляемый объект
-        ptr_ = nullptr;
-        if (weak_count_ == 0) {
-            delete this;                 // удаляем сам блок, если нет наблюдателей
+// Увеличить счетчик владельцев, только если объект еще жив (для WeakPtr::Lock).
+// Мертвый объект (счетчик 0) никогда не воскрешается
+bool ControlBlock::TryIncrementShared() {
+    size_t count = shared_count_.load(std::memory_order_relaxed);
+    while (count != 0) {
+        if (shared_count_.compare_exchange_weak(count, count + 1,
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_relaxed)) {
+            return true;
         }
     }
+    return false;
+}
+
+// Уменьшить счетчик владельцев и удалить объект/блок при необходимости
+void ControlBlock::DecrementShared() {
+    if (shared_count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        DestroyObject();                // уничтожаем управляемый объект
+        DecrementWeak();                // отпускаем слабую ссылку всех владельцев
+    }
 }
 
 // Увеличить счетчик наблюдателей
-void ControlBlock::IncrementWeak() { 
-    ++weak_count_; 
+void ControlBlock::IncrementWeak() {
+    weak_count_.fetch_add(1, std::memory_order_relaxed);
 }
 
 // Уменьшить счетчик наблюдателей и удалить блок при необходимости
-void ControlBlock::DecrementWeak() { 
-    --weak_count_; 
-    if (shared_count_ == 0 && weak_count_ == 0) {
-        delete this;                     // удаляем блок, если нет ни владельцев, ни наблюдателей
+void ControlBlock::DecrementWeak() {
+    if (weak_count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        DestroyBlock();                  // удаляем блок, если нет ни владельцев, ни наблюдателей
     }
 }
 
 // Получить количество владельцев
-size_t ControlBlock::GetSharedCount() const { 
-    return shared_count_; 
+size_t ControlBlock::GetSharedCount() const {
+    return shared_count_.load(std::memory_order_acquire);
+}
+
+// Получить количество наблюдателей (без служебной ссылки владельцев)
+size_t ControlBlock::GetWeakCount() const {
+    size_t weak = weak_count_.load(std::memory_order_acquire);
+    return GetSharedCount() > 0 ? weak - 1 : weak;
+}
+
+// Выделить память под блок через аллокатор, приведенный к типу блока, и создать блок
+template<typename Block, typename Alloc, typename... Args>
+Block* CreateControlBlock(const Alloc& alloc, Args&&... args) {
+    using BlockAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Block>;
+    using Traits = std::allocator_traits<BlockAlloc>;
+    BlockAlloc block_alloc(alloc);
+    Block* block = Traits::allocate(block_alloc, 1);
+    try {
+        Traits::construct(block_alloc, block, std::forward<Args>(args)...);
+    } catch (...) {
+        Traits::deallocate(block_alloc, block, 1);
+        throw;
+    }
+    return block;
+}
+
+// Уничтожить блок и вернуть его память аллокатору
+template<typename Block, typename Alloc>
+void ReleaseControlBlock(Block* block, const Alloc& alloc) {
+    using BlockAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Block>;
+    using Traits = std::allocator_traits<BlockAlloc>;
+    BlockAlloc block_alloc(alloc);
+    Traits::destroy(block_alloc, block);
+    Traits::deallocate(block_alloc, block, 1);
+}
+
+// Класс PtrControlBlock - блок для объекта, выделенного отдельно (SharedPtr(new ...)).
+// Хранит удалитель объекта и аллокатор памяти блока; пустые удалитель и аллокатор
+// не увеличивают размер блока
+template<typename U, typename Deleter, typename Alloc>
+class PtrControlBlock : public ControlBlock {
+private:
+    U* ptr_;
+    [[no_unique_address]] Deleter deleter_;
+    [[no_unique_address]] Alloc alloc_;
+
+    void DestroyObject() override;
+    void DestroyBlock() override;
+
+public:
+    PtrControlBlock(U* ptr, Deleter deleter, const Alloc& alloc);
+};
+
+// Конструктор PtrControlBlock
+template<typename U, typename Deleter, typename Alloc>
+PtrControlBlock<U, Deleter, Alloc>::PtrControlBlock(U* ptr, Deleter deleter, const Alloc& alloc)
+    : ptr_(ptr), deleter_(std::move(deleter)), alloc_(alloc) {}
+
+// Удалить управляемый объект пользовательским удалителем
+template<typename U, typename Deleter, typename Alloc>
+void PtrControlBlock<U, Deleter, Alloc>::DestroyObject() {
+    deleter_(ptr_);
+    ptr_ = nullptr;
 }
 
-// Получить количество наблюдателей
-size_t ControlBlock::GetWeakCount() const { 
-    return weak_count_; 
+// Освободить память блока через аллокатор
+template<typename U, typename Deleter, typename Alloc>
+void PtrControlBlock<U, Deleter, Alloc>::DestroyBlock() {
+    Alloc alloc(std::move(alloc_));
+    ReleaseControlBlock(this, alloc);
 }
 
-// Получить указатель на объект
-std::string* ControlBlock::GetPtr() const { 
-    return ptr_; 
+// Класс InlineControlBlock - блок, хранящий объект внутри себя (для MakeShared).
+// Объект и счетчики лежат в одной аллокации; после смерти объекта слабые ссылки
+// удерживают только память блока
+template<typename T, typename Alloc>
+class InlineControlBlock : public ControlBlock {
+private:
+    using ObjectAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+
+    alignas(T) unsigned char storage_[sizeof(T)];
+    [[no_unique_address]] ObjectAlloc alloc_;
+
+    void DestroyObject() override;
+    void DestroyBlock() override;
+
+public:
+    template<typename... Args>
+    explicit InlineControlBlock(const Alloc& alloc, Args&&... args);
+
+    T* GetPtr();
+};
+
+// Конструктор InlineControlBlock: создает объект прямо в буфере блока
+template<typename T, typename Alloc>
+template<typename... Args>
+InlineControlBlock<T, Alloc>::InlineControlBlock(const Alloc& alloc, Args&&... args)
+    : alloc_(alloc) {
+    std::allocator_traits<ObjectAlloc>::construct(alloc_, reinterpret_cast<T*>(storage_),
+                                                  std::forward<Args>(args)...);
 }
 
-// Класс SharedPtr - умный указатель с разделяемым владением
-class SharedPtr {
+// Вызвать деструктор объекта, не освобождая память блока
+template<typename T, typename Alloc>
+void InlineControlBlock<T, Alloc>::DestroyObject() {
+    std::allocator_traits<ObjectAlloc>::destroy(alloc_, GetPtr());
+}
+
+// Освободить память блока через аллокатор
+template<typename T, typename Alloc>
+void InlineControlBlock<T, Alloc>::DestroyBlock() {
+    ObjectAlloc alloc(std::move(alloc_));
+    ReleaseControlBlock(this, alloc);
+}
+
+// Получить указатель на объект внутри блока
+template<typename T, typename Alloc>
+T* InlineControlBlock<T, Alloc>::GetPtr() {
+    return std::launder(reinterpret_cast<T*>(storage_));
+}
+
+// Класс BasicSharedPtr - умный указатель с разделяемым владением объектом типа T.
+// Хранимый указатель может отличаться от управляемого объекта (aliasing): так
+// несколько указателей на части одного объекта используют один управляющий блок
+template<typename T>
+class BasicSharedPtr {
 private:
-    std::string* ptr_;
+    T* ptr_;
     ControlBlock* block_;
 
+    BasicSharedPtr(T* ptr, ControlBlock* block);
+
+    template<typename U, typename Deleter, typename Alloc>
+    static ControlBlock* CreateBlock(U* ptr, Deleter deleter, const Alloc& alloc);
+
 public:
     // Конструкторы
-    SharedPtr();
-    explicit SharedPtr(std::string* ptr);
-    SharedPtr(const SharedPtr& other);
-    SharedPtr(SharedPtr&& other) noexcept;
-    
+    BasicSharedPtr();
+    BasicSharedPtr(std::nullptr_t);
+    template<typename U> requires std::convertible_to<U*, T*>
+    explicit BasicSharedPtr(U* ptr);
+    template<typename U, typename Deleter> requires std::convertible_to<U*, T*> && std::invocable<Deleter&, U*>
+    BasicSharedPtr(U* ptr, Deleter deleter);
+    template<typename U, typename Deleter, typename Alloc> requires std::convertible_to<U*, T*> && std::invocable<Deleter&, U*>
+    BasicSharedPtr(U* ptr, Deleter deleter, const Alloc& alloc);
+    BasicSharedPtr(const BasicSharedPtr& other);
+    BasicSharedPtr(BasicSharedPtr&& other) noexcept;
+    template<typename U> requires std::convertible_to<U*, T*>
+    BasicSharedPtr(const BasicSharedPtr<U>& other);
+    template<typename U> requires std::convertible_to<U*, T*>
+    BasicSharedPtr(BasicSharedPtr<U>&& other) noexcept;
+
+    // Aliasing-конструкторы: разделяют владение с owner, но указывают на ptr
+    template<typename U>
+    BasicSharedPtr(const BasicSharedPtr<U>& owner, T* ptr);
+    template<typename U>
+    BasicSharedPtr(BasicSharedPtr<U>&& owner, T* ptr) noexcept;
+
     // Деструктор
-    ~SharedPtr();
-    
+    ~BasicSharedPtr();
+
     // Операторы присваивания
-    SharedPtr& operator=(const SharedPtr& other);
-    SharedPtr& operator=(SharedPtr&& other) noexcept;
-    
+    BasicSharedPtr& operator=(const BasicSharedPtr& other);
+    BasicSharedPtr& operator=(BasicSharedPtr&& other) noexcept;
+
     // Операторы разыменования
-    std::string& operator*() const;
-    std::string* operator->() const;
+    T& operator*() const;
+    T* operator->() const;
     explicit operator bool() const;
-    
+
     // Методы
-    std::string* Get() const;
-    void Reset(std::string* new_ptr = nullptr);
-    void Swap(SharedPtr& other);
+    T* Get() const;
+    void Reset();
+    template<typename U>
+    void Reset(U* new_ptr);
+    template<typename U, typename Deleter>
+    void Reset(U* new_ptr, Deleter deleter);
+    template<typename U, typename Deleter, typename Alloc>
+    void Reset(U* new_ptr, Deleter deleter, const Alloc& alloc);
+    void Swap(BasicSharedPtr& other);
     size_t UseCount() const;
 
-    friend class WeakPtr;
-    friend SharedPtr MakeShared(const std::string& str);
-    friend SharedPtr MakeShared(std::string&& str);
-    friend void Swap(SharedPtr& lhs, SharedPtr& rhs);
+    template<typename U>
+    friend class BasicSharedPtr;
+    template<typename U>
+    friend class BasicWeakPtr;
+    template<typename U>
+    friend class AtomicSharedPtr;
+    template<typename U, typename Alloc, typename... Args>
+    friend BasicSharedPtr<U> AllocateShared(const Alloc& alloc, Args&&... args);
 };
 
+// Создать блок для отдельно выделенного объекта. Если память под блок
+// выделить не удалось, объект удаляется, чтобы не было утечки
+template<typename T>
+template<typename U, typename Deleter, typename Alloc>
+ControlBlock* BasicSharedPtr<T>::CreateBlock(U* ptr, Deleter deleter, const Alloc& alloc) {
+    try {
+        return CreateControlBlock<PtrControlBlock<U, Deleter, Alloc>>(alloc, ptr, deleter, alloc);
+    } catch (...) {
+        deleter(ptr);
+        throw;
+    }
+}
+
 // Конструктор по умолчанию
-SharedPtr::SharedPtr() : ptr_(nullptr), block_(nullptr) {}
+template<typename T>
+BasicSharedPtr<T>::BasicSharedPtr() : ptr_(nullptr), block_(nullptr) {}
+
+// Конструктор от nullptr
+template<typename T>
+BasicSharedPtr<T>::BasicSharedPtr(std::nullptr_t) : BasicSharedPtr() {}
 
 // Конструктор от сырого указателя
-SharedPtr::SharedPtr(std::string* ptr) : ptr_(ptr), block_(nullptr) {
+template<typename T>
+template<typename U> requires std::convertible_to<U*, T*>
+BasicSharedPtr<T>::BasicSharedPtr(U* ptr)
+    : BasicSharedPtr(ptr, DefaultDelete<U>(), std::allocator<U>()) {}
+
+// Конструктор от сырого указателя с пользовательским удалителем
+template<typename T>
+template<typename U, typename Deleter> requires std::convertible_to<U*, T*> && std::invocable<Deleter&, U*>
+BasicSharedPtr<T>::BasicSharedPtr(U* ptr, Deleter deleter)
+    : BasicSharedPtr(ptr, std::move(deleter), std::allocator<U>()) {}
+
+// Конструктор с удалителем и аллокатором для памяти управляющего блока
+template<typename T>
+template<typename U, typename Deleter, typename Alloc> requires std::convertible_to<U*, T*> && std::invocable<Deleter&, U*>
+BasicSharedPtr<T>::BasicSharedPtr(U* ptr, Deleter deleter, const Alloc& alloc)
+    : ptr_(ptr), block_(nullptr) {
     if (ptr_) {
-        block_ = new ControlBlock(ptr_);
+        block_ = CreateBlock(ptr, std::move(deleter), alloc);
     }
 }
 
+// Конструктор от готового блока, владение которым уже учтено в счетчике
+template<typename T>
+BasicSharedPtr<T>::BasicSharedPtr(T* ptr, ControlBlock* block) : ptr_(ptr), block_(block) {}
+
 // Копирующий конструктор
-SharedPtr::SharedPtr(const SharedPtr& other) : ptr_(other.ptr_), block_(other.block_) {
+template<typename T>
+BasicSharedPtr<T>::BasicSharedPtr(const BasicSharedPtr& other)
+    : ptr_(other.ptr_), block_(other.block_) {
     if (block_) {
         block_->IncrementShared();  // увеличиваем счетчик владельцев
     }
 }
 
 // Перемещающий конструктор
-SharedPtr::SharedPtr(SharedPtr&& other) noexcept : ptr_(other.ptr_), block_(other.block_) {
+template<typename T>
+BasicSharedPtr<T>::BasicSharedPtr(BasicSharedPtr&& other) noexcept
+    : ptr_(other.ptr_), block_(other.block_) {
     other.ptr_ = nullptr;           // обнуляем указатели источника
     other.block_ = nullptr;
 }
 
+// Копирующий конструктор от указателя на совместимый тип (например, наследника)
+template<typename T>
+template<typename U> requires std::convertible_to<U*, T*>
+BasicSharedPtr<T>::BasicSharedPtr(const BasicSharedPtr<U>& other)
+    : ptr_(other.ptr_), block_(other.block_) {
+    if (block_) {
+        block_->IncrementShared();
+    }
+}
+
+// Перемещающий конструктор от указателя на совместимый тип
+template<typename T>
+template<typename U> requires std::convertible_to<U*, T*>
+BasicSharedPtr<T>::BasicSharedPtr(BasicSharedPtr<U>&& other) noexcept
+    : ptr_(other.ptr_), block_(other.block_) {
+    other.ptr_ = nullptr;
+    other.block_ = nullptr;
+}
+
+// Aliasing-конструктор: новый владелец блока owner, указывающий на ptr
+template<typename T>
+template<typename U>
+BasicSharedPtr<T>::BasicSharedPtr(const BasicSharedPtr<U>& owner, T* ptr)
+    : ptr_(ptr), block_(owner.block_) {
+    if (block_) {
+        block_->IncrementShared();
+    }
+}
+
+// Aliasing-конструктор с перемещением: забирает владение у owner без изменения счетчика
+template<typename T>
+template<typename U>
+BasicSharedPtr<T>::BasicSharedPtr(BasicSharedPtr<U>&& owner, T* ptr) noexcept
+    : ptr_(ptr), block_(owner.block_) {
+    owner.ptr_ = nullptr;
+    owner.block_ = nullptr;
+}
+
 // Деструктор
-SharedPtr::~SharedPtr() {
+template<typename T>
+BasicSharedPtr<T>::~BasicSharedPtr() {
     if (block_) {
         block_->DecrementShared();  // уменьшаем счетчик владельцев
     }
 }
 
 // Копирующее присваивание
-SharedPtr& SharedPtr::operator=(const SharedPtr& other) {
+template<typename T>
+BasicSharedPtr<T>& BasicSharedPtr<T>::operator=(const BasicSharedPtr& other) {
     if (this != &other) {           // защита от самоприсваивания
         if (block_) {
             block_->DecrementShared();  // освобождаем текущий ресурс
@@ -158,7 +423,8 @@ SharedPtr& SharedPtr::operator=(const SharedPtr& other) {
 }
 
 // Перемещающее присваивание
-SharedPtr& SharedPtr::operator=(SharedPtr&& other) noexcept {
+template<typename T>
+BasicSharedPtr<T>& BasicSharedPtr<T>::operator=(BasicSharedPtr&& other) noexcept {
     if (this != &other) {           // защита от самоприсваивания
         if (block_) {
             block_->DecrementShared();  // освобождаем текущий ресурс
@@ -172,113 +438,139 @@ SharedPtr& SharedPtr::operator=(SharedPtr&& other) noexcept {
 }
 
 // Оператор разыменования
-std::string& SharedPtr::operator*() const { 
-    return *ptr_; 
+template<typename T>
+T& BasicSharedPtr<T>::operator*() const {
+    return *ptr_;
 }
 
 // Оператор доступа к членам
-std::string* SharedPtr::operator->() const { 
-    return ptr_; 
+template<typename T>
+T* BasicSharedPtr<T>::operator->() const {
+    return ptr_;
 }
 
 // Оператор преобразования к bool
-SharedPtr::operator bool() const { 
-    return ptr_ != nullptr; 
+template<typename T>
+BasicSharedPtr<T>::operator bool() const {
+    return ptr_ != nullptr;
 }
 
 // Получить сырой указатель
-std::string* SharedPtr::Get() const { 
-    return ptr_; 
+template<typename T>
+T* BasicSharedPtr<T>::Get() const {
+    return ptr_;
 }
 
 // Сбросить указатель
-void SharedPtr::Reset(std::string* new_ptr) {
-    if (block_) {
-        block_->DecrementShared();  // освобождаем текущий ресурс
-    }
-    ptr_ = new_ptr;                  // устанавливаем новый указатель
-    if (ptr_) {
-        block_ = new ControlBlock(ptr_);  // создаем новый управляющий блок
-    } else {
-        block_ = nullptr;
-    }
+template<typename T>
+void BasicSharedPtr<T>::Reset() {
+    BasicSharedPtr().Swap(*this);
+}
+
+// Сбросить указатель и начать владеть новым объектом
+template<typename T>
+template<typename U>
+void BasicSharedPtr<T>::Reset(U* new_ptr) {
+    BasicSharedPtr(new_ptr).Swap(*this);
+}
+
+template<typename T>
+template<typename U, typename Deleter>
+void BasicSharedPtr<T>::Reset(U* new_ptr, Deleter deleter) {
+    BasicSharedPtr(new_ptr, std::move(deleter)).Swap(*this);
+}
+
+template<typename T>
+template<typename U, typename Deleter, typename Alloc>
+void BasicSharedPtr<T>::Reset(U* new_ptr, Deleter deleter, const Alloc& alloc) {
+    BasicSharedPtr(new_ptr, std::move(deleter), alloc).Swap(*this);
 }
 
 // Обмен с другим SharedPtr
-void SharedPtr::Swap(SharedPtr& other) {
+template<typename T>
+void BasicSharedPtr<T>::Swap(BasicSharedPtr& other) {
     std::swap(ptr_, other.ptr_);
     std::swap(block_, other.block_);
 }
 
 // Получить количество владельцев
-size_t SharedPtr::UseCount() const {
+template<typename T>
+size_t BasicSharedPtr<T>::UseCount() const {
     return block_ ? block_->GetSharedCount() : 0;
 }
 
-// Класс WeakPtr - умный указатель-наблюдатель
-class WeakPtr {
+// Класс BasicWeakPtr - умный указатель-наблюдатель
+template<typename T>
+class BasicWeakPtr {
 private:
-    std::string* ptr_;          // указатель на наблюдаемый объект
+    T* ptr_;                    // указатель на наблюдаемый объект
     ControlBlock* block_;       // указатель на управляющий блок
 
 public:
     // Конструкторы
-    WeakPtr();
-    WeakPtr(const SharedPtr& sp);
-    WeakPtr(const WeakPtr& other);
-    WeakPtr(WeakPtr&& other) noexcept;
-    
+    BasicWeakPtr();
+    template<typename U>
+    BasicWeakPtr(const BasicSharedPtr<U>& sp);
+    BasicWeakPtr(const BasicWeakPtr& other);
+    BasicWeakPtr(BasicWeakPtr&& other) noexcept;
+
     // Деструктор
-    ~WeakPtr();
-    
+    ~BasicWeakPtr();
+
     // Операторы присваивания
-    WeakPtr& operator=(const WeakPtr& other);
-    WeakPtr& operator=(WeakPtr&& other) noexcept;
-    WeakPtr& operator=(const SharedPtr& sp);
-    
+    BasicWeakPtr& operator=(const BasicWeakPtr& other);
+    BasicWeakPtr& operator=(BasicWeakPtr&& other) noexcept;
+    template<typename U>
+    BasicWeakPtr& operator=(const BasicSharedPtr<U>& sp);
+
     // Методы
     void Reset();
-    void Swap(WeakPtr& other);
+    void Swap(BasicWeakPtr& other);
     size_t UseCount() const;
     bool Expired() const;
-    SharedPtr Lock() const;
-
-    friend void Swap(WeakPtr& lhs, WeakPtr& rhs);
+    BasicSharedPtr<T> Lock() const;
 };
 
 // Конструктор по умолчанию
-WeakPtr::WeakPtr() : ptr_(nullptr), block_(nullptr) {}
+template<typename T>
+BasicWeakPtr<T>::BasicWeakPtr() : ptr_(nullptr), block_(nullptr) {}
 
 // Конструктор от SharedPtr
-WeakPtr::WeakPtr(const SharedPtr& sp) : ptr_(sp.ptr_), block_(sp.block_) {
+template<typename T>
+template<typename U>
+BasicWeakPtr<T>::BasicWeakPtr(const BasicSharedPtr<U>& sp) : ptr_(sp.ptr_), block_(sp.block_) {
     if (block_) {
         block_->IncrementWeak();  // увеличиваем счетчик наблюдателей
     }
 }
 
 // Копирующий конструктор
-WeakPtr::WeakPtr(const WeakPtr& other) : ptr_(other.ptr_), block_(other.block_) {
+template<typename T>
+BasicWeakPtr<T>::BasicWeakPtr(const BasicWeakPtr& other) : ptr_(other.ptr_), block_(other.block_) {
     if (block_) {
         block_->IncrementWeak();  // увеличиваем счетчик наблюдателей
     }
 }
 
 // Перемещающий конструктор
-WeakPtr::WeakPtr(WeakPtr&& other) noexcept : ptr_(other.ptr_), block_(other.block_) {
+template<typename T>
+BasicWeakPtr<T>::BasicWeakPtr(BasicWeakPtr&& other) noexcept : ptr_(other.ptr_), block_(other.block_) {
     other.ptr_ = nullptr;          // обнуляем указатели источника
     other.block_ = nullptr;
 }
 
 // Деструктор
-WeakPtr::~WeakPtr() {
+template<typename T>
+BasicWeakPtr<T>::~BasicWeakPtr() {
     if (block_) {
         block_->DecrementWeak();  // уменьшаем счетчик наблюдателей
     }
 }
 
 // Копирующее присваивание
-WeakPtr& WeakPtr::operator=(const WeakPtr& other) {
-    if (this != &other) {         
+template<typename T>
+BasicWeakPtr<T>& BasicWeakPtr<T>::operator=(const BasicWeakPtr& other) {
+    if (this != &other) {
         if (block_) {
             block_->DecrementWeak();  // освобождаем текущий ресурс
         }
@@ -292,10 +584,11 @@ WeakPtr& WeakPtr::operator=(const WeakPtr& other) {
 }
 
 // Перемещающее присваивание
-WeakPtr& WeakPtr::operator=(WeakPtr&& other) noexcept {
-    if (this != &other) {          
+template<typename T>
+BasicWeakPtr<T>& BasicWeakPtr<T>::operator=(BasicWeakPtr&& other) noexcept {
+    if (this != &other) {
         if (block_) {
-            block_->DecrementWeak();  
+            block_->DecrementWeak();
         }
         ptr_ = other.ptr_;          // перемещаем указатели
         block_ = other.block_;
@@ -306,20 +599,23 @@ WeakPtr& WeakPtr::operator=(WeakPtr&& other) noexcept {
 }
 
 // Присваивание от SharedPtr
-WeakPtr& WeakPtr::operator=(const SharedPtr& sp) {
+template<typename T>
+template<typename U>
+BasicWeakPtr<T>& BasicWeakPtr<T>::operator=(const BasicSharedPtr<U>& sp) {
+    if (sp.block_) {
+        sp.block_->IncrementWeak();  // сначала захватываем новый блок: он может совпадать с текущим
+    }
     if (block_) {
         block_->DecrementWeak();  // освобождаем текущий ресурс
     }
     ptr_ = sp.ptr_;                 // устанавливаем новые указатели
     block_ = sp.block_;
-    if (block_) {
-        block_->IncrementWeak();  // увеличиваем счетчик наблюдателей
-    }
     return *this;
 }
 
 // Сбросить указатель
-void WeakPtr::Reset() {
+template<typename T>
+void BasicWeakPtr<T>::Reset() {
     if (block_) {
         block_->DecrementWeak();  // уменьшаем счетчик наблюдателей
         ptr_ = nullptr;             // обнуляем указатели
@@ -328,49 +624,519 @@ void WeakPtr::Reset() {
 }
 
 // Обмен с другим WeakPtr
-void WeakPtr::Swap(WeakPtr& other) {
+template<typename T>
+void BasicWeakPtr<T>::Swap(BasicWeakPtr& other) {
     std::swap(ptr_, other.ptr_);
     std::swap(block_, other.block_);
 }
 
 // Получить количество владельцев
-size_t WeakPtr::UseCount() const {
+template<typename T>
+size_t BasicWeakPtr<T>::UseCount() const {
     return block_ ? block_->GetSharedCount() : 0;
 }
 
 // Проверка, жив ли объект
-bool WeakPtr::Expired() const {
+template<typename T>
+bool BasicWeakPtr<T>::Expired() const {
     return block_ ? (block_->GetSharedCount() == 0) : true;
 }
 
 // Получить SharedPtr на объект, если он еще жив
-SharedPtr WeakPtr::Lock() const {
-    if (block_ && block_->GetSharedCount() > 0) {
-        SharedPtr sp;
-        sp.ptr_ = ptr_;
-        sp.block_ = block_;
-        sp.block_->IncrementShared();  // увеличиваем счетчик владельцев
-        return sp;
+template<typename T>
+BasicSharedPtr<T> BasicWeakPtr<T>::Lock() const {
+    if (block_ && block_->TryIncrementShared()) {  // атомарно захватываем владение
+        return BasicSharedPtr<T>(ptr_, block_);
     }
-    return SharedPtr();  // возвращаем пустой SharedPtr, если объект мертв
+    return BasicSharedPtr<T>();  // возвращаем пустой SharedPtr, если объект мертв
+}
+
+// Указатели на строку - основной вариант использования
+using SharedPtr = BasicSharedPtr<std::string>;
+using WeakPtr = BasicWeakPtr<std::string>;
+
+// Функция AllocateShared - создает объект и управляющий блок одной аллокацией
+// через переданный аллокатор
+template<typename T, typename Alloc, typename... Args>
+BasicSharedPtr<T> AllocateShared(const Alloc& alloc, Args&&... args) {
+    auto* block = CreateControlBlock<InlineControlBlock<T, Alloc>>(
+        alloc, alloc, std::forward<Args>(args)...);
+    return BasicSharedPtr<T>(block->GetPtr(), block);
+}
+
+// Функция MakeShared - создает объект и управляющий блок одной аллокацией
+template<typename T, typename... Args>
+BasicSharedPtr<T> MakeShared(Args&&... args) {
+    return AllocateShared<T>(std::allocator<T>(), std::forward<Args>(args)...);
 }
 
 // Функция MakeShared для создания SharedPtr (копирование)
 SharedPtr MakeShared(const std::string& str) {
-    return SharedPtr(new std::string(str));
+    return MakeShared<std::string>(str);
 }
 
 // Функция MakeShared для создания SharedPtr (перемещение)
 SharedPtr MakeShared(std::string&& str) {
-    return SharedPtr(new std::string(std::move(str)));
+    return MakeShared<std::string>(std::move(str));
+}
+
+// Класс AtomicSharedPtr - ячейка с SharedPtr, которую можно читать и менять из
+// разных потоков без блокировок (публикация редко меняющихся снимков данных).
+//
+// Используется раздельный подсчет ссылок. Ячейка хранит указатель на неизменяемый
+// узел с копией SharedPtr, а в старших 16 битах того же слова - число читателей,
+// которые сейчас копируют значение узла (внешний счетчик). Читатель увеличивает
+// внешний счетчик, копирует значение и уменьшает счетчик обратно. Если узел за это
+// время заменили, писатель переносит внешний счетчик во внутренний счетчик узла,
+// и каждый опоздавший читатель возвращает свой долг уже туда. Узел удаляет тот,
+// кто обнулил внутренний счетчик.
+//
+// Ограничения: адрес узла должен помещаться в младшие 48 бит (Pack бросает
+// std::runtime_error при 57-битных адресах или теговых указателях), а читателей,
+// одновременно копирующих значение, не больше 65535 - остальные ждут
+template<typename T>
+class AtomicSharedPtr {
+private:
+    struct Node {
+        BasicSharedPtr<T> value;
+        std::atomic<intptr_t> debt{0};  // внутренний счетчик
+    };
+
+    static constexpr int kCountShift = 48;
+    static constexpr uintptr_t kOne = uintptr_t(1) << kCountShift;
+    static constexpr uintptr_t kPtrMask = kOne - 1;
+    static constexpr uintptr_t kMaxReaders = ~uintptr_t(0) >> kCountShift;
+
+    mutable std::atomic<uintptr_t> word_;
+
+    static Node* NodeOf(uintptr_t word);
+    static uintptr_t CountOf(uintptr_t word);
+    static uintptr_t Pack(BasicSharedPtr<T> value);
+    static bool SameOwner(const BasicSharedPtr<T>& lhs, const BasicSharedPtr<T>& rhs);
+
+    uintptr_t Acquire() const;
+    void Release(Node* node) const;
+    static void PayDebt(Node* node, intptr_t amount);
+
+public:
+    // Конструкторы
+    AtomicSharedPtr();
+    explicit AtomicSharedPtr(BasicSharedPtr<T> desired);
+    AtomicSharedPtr(const AtomicSharedPtr& other) = delete;
+
+    // Деструктор
+    ~AtomicSharedPtr();
+
+    // Операторы присваивания
+    AtomicSharedPtr& operator=(const AtomicSharedPtr& other) = delete;
+
+    // Методы
+    BasicSharedPtr<T> Load() const;
+    void Store(BasicSharedPtr<T> desired);
+    BasicSharedPtr<T> Exchange(BasicSharedPtr<T> desired);
+    bool CompareExchange(BasicSharedPtr<T>& expected, BasicSharedPtr<T> desired);
+    bool IsLockFree() const;
+};
+
+// Узел, записанный в слове ячейки
+template<typename T>
+typename AtomicSharedPtr<T>::Node* AtomicSharedPtr<T>::NodeOf(uintptr_t word) {
+    return reinterpret_cast<Node*>(word & kPtrMask);
+}
+
+// Число читателей, записанное в слове ячейки
+template<typename T>
+uintptr_t AtomicSharedPtr<T>::CountOf(uintptr_t word) {
+    return word >> kCountShift;
+}
+
+// Слово ячейки для нового узла со значением value и без читателей
+template<typename T>
+uintptr_t AtomicSharedPtr<T>::Pack(BasicSharedPtr<T> value) {
+    static_assert(sizeof(uintptr_t) == 8, "AtomicSharedPtr requires 64-bit pointers");
+    std::unique_ptr<Node> node(new Node{std::move(value)});
+    uintptr_t word = reinterpret_cast<uintptr_t>(node.get());
+    if (word & ~kPtrMask) {
+        // старшие биты заняты (57-битные адреса, теговые указатели)
+        throw std::runtime_error("AtomicSharedPtr: node address does not fit in 48 bits");
+    }
+    node.release();
+    return word;
+}
+
+// Указатели равны, если совпадают и адрес, и управляющий блок
+template<typename T>
+bool AtomicSharedPtr<T>::SameOwner(const BasicSharedPtr<T>& lhs, const BasicSharedPtr<T>& rhs) {
+    return lhs.ptr_ == rhs.ptr_ && lhs.block_ == rhs.block_;
+}
+
+// Защитить текущий узел от удаления: увеличить внешний счетчик.
+// Возвращает слово с учетом собственного увеличения (0 - ячейка пуста)
+template<typename T>
+uintptr_t AtomicSharedPtr<T>::Acquire() const {
+    uintptr_t word = word_.load(std::memory_order_relaxed);
+    while (NodeOf(word) != nullptr) {
+        if (CountOf(word) == kMaxReaders) {
+            // счетчик читателей заполнен: ждем, пока кто-то из них закончит
+            std::this_thread::yield();
+            word = word_.load(std::memory_order_relaxed);
+            continue;
+        }
+        if (word_.compare_exchange_weak(word, word + kOne,
+                                        std::memory_order_acquire,
+                                        std::memory_order_relaxed)) {
+            return word + kOne;
+        }
+    }
+    return 0;
+}
+
+// Снять защиту узла: уменьшить внешний счетчик, а если узел уже заменен -
+// вернуть долг во внутренний счетчик
+template<typename T>
+void AtomicSharedPtr<T>::Release(Node* node) const {
+    uintptr_t word = word_.load(std::memory_order_relaxed);
+    while (NodeOf(word) == node) {
+        if (word_.compare_exchange_weak(word, word - kOne,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+            return;
+        }
+    }
+    PayDebt(node, -1);
+}
+
+// Изменить внутренний счетчик узла и удалить узел, если долгов не осталось
+template<typename T>
+void AtomicSharedPtr<T>::PayDebt(Node* node, intptr_t amount) {
+    if (node->debt.fetch_add(amount, std::memory_order_acq_rel) + amount == 0) {
+        delete node;
+    }
+}
+
+// Конструктор по умолчанию - пустая ячейка
+template<typename T>
+AtomicSharedPtr<T>::AtomicSharedPtr() : word_(0) {}
+
+// Конструктор от начального значения
+template<typename T>
+AtomicSharedPtr<T>::AtomicSharedPtr(BasicSharedPtr<T> desired)
+    : word_(Pack(std::move(desired))) {}
+
+// Деструктор: параллельных обращений к ячейке уже нет
+template<typename T>
+AtomicSharedPtr<T>::~AtomicSharedPtr() {
+    delete NodeOf(word_.load(std::memory_order_acquire));
+}
+
+// Прочитать текущее значение
+template<typename T>
+BasicSharedPtr<T> AtomicSharedPtr<T>::Load() const {
+    Node* node = NodeOf(Acquire());
+    if (!node) {
+        return BasicSharedPtr<T>();
+    }
+    BasicSharedPtr<T> result = node->value;
+    Release(node);
+    return result;
+}
+
+// Записать новое значение
+template<typename T>
+void AtomicSharedPtr<T>::Store(BasicSharedPtr<T> desired) {
+    Exchange(std::move(desired));
+}
+
+// Записать новое значение и вернуть старое
+template<typename T>
+BasicSharedPtr<T> AtomicSharedPtr<T>::Exchange(BasicSharedPtr<T> desired) {
+    uintptr_t old = word_.exchange(Pack(std::move(desired)), std::memory_order_acq_rel);
+    Node* node = NodeOf(old);
+    if (!node) {
+        return BasicSharedPtr<T>();
+    }
+    BasicSharedPtr<T> result = node->value;  // узел жив, пока мы не перенесли счетчик
+    PayDebt(node, static_cast<intptr_t>(CountOf(old)));
+    return result;
+}
+
+// Заменить значение на desired, если текущее совпадает с expected.
+// При неудаче expected получает текущее значение
+template<typename T>
+bool AtomicSharedPtr<T>::CompareExchange(BasicSharedPtr<T>& expected, BasicSharedPtr<T> desired) {
+    uintptr_t new_word = Pack(std::move(desired));
+    while (true) {
+        Node* node = NodeOf(Acquire());
+        BasicSharedPtr<T> current = node ? node->value : BasicSharedPtr<T>();
+        if (!SameOwner(current, expected)) {
+            if (node) {
+                Release(node);
+            }
+            expected = std::move(current);
+            delete NodeOf(new_word);
+            return false;
+        }
+
+        uintptr_t word = word_.load(std::memory_order_relaxed);
+        while (NodeOf(word) == node) {
+            if (word_.compare_exchange_weak(word, new_word,
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_relaxed)) {
+                if (node) {
+                    // переносим внешний счетчик, сразу возвращая свой долг
+                    PayDebt(node, static_cast<intptr_t>(CountOf(word)) - 1);
+                }
+                return true;
+            }
+        }
+        if (node) {
+            Release(node);  // узел заменили, пробуем еще раз
+        }
+    }
+}
+
+// Ячейка не использует блокировок, если атомарное слово на платформе lock-free
+template<typename T>
+bool AtomicSharedPtr<T>::IsLockFree() const {
+    return word_.is_lock_free();
+}
+
+// Класс EpochDomain - отложенное удаление объектов по эпохам (epoch-based reclamation).
+// Альтернатива SharedPtr для горячих путей чтения: читатель не трогает общие счетчики,
+// а только объявляет в собственной записи (своей кэш-линии) эпоху, в которой он читает.
+// Писатель сначала убирает объект из общих структур, затем передает его в Retire.
+// Объект удаляется, когда глобальная эпоха продвинулась на 2 вперед: это возможно,
+// только когда все читатели, которые могли его видеть, вышли из критической секции
+class EpochDomain {
+private:
+    struct alignas(64) Record {
+        std::atomic<uint64_t> state{0};  // (эпоха << 1) | 1, если поток читает; 0 - вне секции
+        std::atomic<bool> in_use{true};
+        Record* next = nullptr;
+    };
+
+    struct Retired {
+        void* ptr;
+        void (*deleter)(void*);
+        uint64_t epoch;
+    };
+
+    static constexpr size_t kCollectThreshold = 64;
+
+    std::atomic<uint64_t> epoch_;
+    std::atomic<Record*> records_;
+    std::mutex retired_mutex_;
+    std::vector<Retired> retired_;
+
+    Record* AcquireRecord();
+    bool TryAdvance();
+
+    friend class EpochReader;
+
+public:
+    // Конструкторы
+    EpochDomain();
+    EpochDomain(const EpochDomain& other) = delete;
+
+    // Деструктор: читателей уже нет, удаляет все отложенные объекты
+    ~EpochDomain();
+
+    // Операторы присваивания
+    EpochDomain& operator=(const EpochDomain& other) = delete;
+
+    // Методы
+    void Retire(void* ptr, void (*deleter)(void*));
+    template<typename T>
+    void Retire(T* ptr);
+    size_t Collect();
+    uint64_t Epoch() const;
+};
+
+// Класс EpochReader - регистрация потока-читателя в домене. Создается в каждом
+// читающем потоке и используется только им
+class EpochReader {
+private:
+    EpochDomain::Record* record_;
+    EpochDomain* domain_;
+    size_t depth_;              // вложенность критических секций
+
+public:
+    class Guard {
+    private:
+        EpochReader* reader_;
+
+    public:
+        explicit Guard(EpochReader& reader);
+        Guard(const Guard& other) = delete;
+        ~Guard();
+        Guard& operator=(const Guard& other) = delete;
+    };
+
+    // Конструкторы
+    explicit EpochReader(EpochDomain& domain);
+    EpochReader(const EpochReader& other) = delete;
+
+    // Деструктор
+    ~EpochReader();
+
+    // Операторы присваивания
+    EpochReader& operator=(const EpochReader& other) = delete;
+
+    // Методы
+    void Enter();
+    void Exit();
+    Guard Pin();
+};
+
+// Конструктор по умолчанию
+EpochDomain::EpochDomain() : epoch_(0), records_(nullptr) {}
+
+// Деструктор
+EpochDomain::~EpochDomain() {
+    for (const Retired& item : retired_) {
+        item.deleter(item.ptr);
+    }
+    Record* record = records_.load(std::memory_order_acquire);
+    while (record) {
+        Record* next = record->next;
+        delete record;
+        record = next;
+    }
+}
+
+// Занять свободную запись читателя или добавить новую в список без блокировок
+EpochDomain::Record* EpochDomain::AcquireRecord() {
+    for (Record* record = records_.load(std::memory_order_acquire); record; record = record->next) {
+        bool expected = false;
+        if (record->in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            return record;
+        }
+    }
+    Record* record = new Record();
+    record->next = records_.load(std::memory_order_relaxed);
+    while (!records_.compare_exchange_weak(record->next, record,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+    }
+    return record;
+}
+
+// Продвинуть эпоху, если все читатели в критических секциях видят текущую.
+// Вызывается только под retired_mutex_, поэтому все Retire упорядочены с продвижением
+bool EpochDomain::TryAdvance() {
+    uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+    for (Record* record = records_.load(std::memory_order_acquire); record; record = record->next) {
+        uint64_t state = record->state.load(std::memory_order_seq_cst);
+        if ((state & 1) && (state >> 1) != epoch) {
+            return false;
+        }
+    }
+    return epoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+}
+
+// Отложить удаление объекта, уже недоступного новым читателям
+void EpochDomain::Retire(void* ptr, void (*deleter)(void*)) {
+    bool collect = false;
+    {
+        std::lock_guard<std::mutex> lock(retired_mutex_);
+        retired_.push_back({ptr, deleter, epoch_.load(std::memory_order_acquire)});
+        collect = retired_.size() >= kCollectThreshold;
+    }
+    if (collect) {
+        Collect();
+    }
+}
+
+// Отложить удаление объекта, созданного через new
+template<typename T>
+void EpochDomain::Retire(T* ptr) {
+    Retire(ptr, [](void* p) { delete static_cast<T*>(p); });
+}
+
+// Попробовать продвинуть эпоху и удалить объекты, которые уже никто не читает.
+// Возвращает число удаленных объектов
+size_t EpochDomain::Collect() {
+    std::vector<Retired> ready;
+    {
+        std::lock_guard<std::mutex> lock(retired_mutex_);
+        TryAdvance();
+        uint64_t epoch = epoch_.load(std::memory_order_acquire);
+        size_t kept = 0;
+        for (const Retired& item : retired_) {
+            if (item.epoch + 2 <= epoch) {
+                ready.push_back(item);
+            } else {
+                retired_[kept++] = item;
+            }
+        }
+        retired_.resize(kept);
+    }
+    for (const Retired& item : ready) {
+        item.deleter(item.ptr);    // удаляем вне блокировки: удалитель может вызвать Retire
+    }
+    return ready.size();
+}
+
+// Получить текущую глобальную эпоху
+uint64_t EpochDomain::Epoch() const {
+    return epoch_.load(std::memory_order_acquire);
+}
+
+// Конструктор EpochReader
+EpochReader::EpochReader(EpochDomain& domain)
+    : record_(domain.AcquireRecord()), domain_(&domain), depth_(0) {}
+
+// Деструктор: освобождает запись для повторного использования
+EpochReader::~EpochReader() {
+    record_->state.store(0, std::memory_order_release);
+    record_->in_use.store(false, std::memory_order_release);
+}
+
+// Войти в критическую секцию чтения. Объявленная эпоха перепроверяется: если
+// эпоха сменилась до того, как объявление стало видно, объявляем заново
+void EpochReader::Enter() {
+    if (depth_++ == 0) {
+        uint64_t epoch = domain_->epoch_.load(std::memory_order_seq_cst);
+        while (true) {
+            record_->state.store((epoch << 1) | 1, std::memory_order_seq_cst);
+            uint64_t current = domain_->epoch_.load(std::memory_order_seq_cst);
+            if (current == epoch) {
+                break;
+            }
+            epoch = current;
+        }
+    }
+}
+
+// Выйти из критической секции чтения
+void EpochReader::Exit() {
+    if (--depth_ == 0) {
+        record_->state.store(0, std::memory_order_release);
+    }
+}
+
+// Войти в критическую секцию до конца области видимости
+EpochReader::Guard EpochReader::Pin() {
+    return Guard(*this);
+}
+
+// Guard входит в секцию при создании и выходит при уничтожении
+EpochReader::Guard::Guard(EpochReader& reader) : reader_(&reader) {
+    reader_->Enter();
+}
+
+EpochReader::Guard::~Guard() {
+    reader_->Exit();
 }
 
 // Функция Swap для обмена SharedPtr
-void Swap(SharedPtr& lhs, SharedPtr& rhs) {
+template<typename T>
+void Swap(BasicSharedPtr<T>& lhs, BasicSharedPtr<T>& rhs) {
     lhs.Swap(rhs);
 }
 
 // Функция Swap для обмена WeakPtr
-void Swap(WeakPtr& lhs, WeakPtr& rhs) {
+template<typename T>
+void Swap(BasicWeakPtr<T>& lhs, BasicWeakPtr<T>& rhs) {
     lhs.Swap(rhs);
-}
\ No newline at end of file
+}
@@ -1,4 +1,9 @@
 #include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <memory_resource>
+#include <thread>
+#include <vector>
 
 #include "smart_ptr.cpp"
 
@@ -659,6 +664,25 @@ TEST(MakeSharedTest, MakeSharedWithMove) {
     EXPECT_EQ(ptr.UseCount(), 1);
 }
 
+TEST(MakeSharedTest, WeakPtrOutlivesInlineObject) {
+    WeakPtr wp;
+    {
+        SharedPtr sp = MakeShared(std::string("testWithLongStringForAvoidSSO"));
+        SharedPtr copy = sp;
+        wp = sp;
+        EXPECT_EQ(wp.UseCount(), 2);
+        EXPECT_EQ(*wp.Lock(), "testWithLongStringForAvoidSSO");
+    }
+
+    EXPECT_TRUE(wp.Expired());
+    EXPECT_EQ(wp.UseCount(), 0);
+    EXPECT_FALSE(wp.Lock());
+
+    WeakPtr copy(wp);
+    wp.Reset();
+    EXPECT_TRUE(copy.Expired());
+}
+
 // Swap function tests
 
 TEST(SwapFunctionTest, SwapSharedPtr) {
@@ -688,6 +712,324 @@ TEST(SwapFunctionTest, SwapWeakPtr) {
     EXPECT_EQ(*wp2.Lock(), "test1");
 }
 
+// Generic BasicSharedPtr<T>
+
+struct Pair {
+    int first;
+    int second;
+};
+
+template<typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    size_t* allocations;
+
+    explicit CountingAllocator(size_t* counter) : allocations(counter) {}
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U>& other) : allocations(other.allocations) {}
+
+    T* allocate(size_t n) {
+        ++*allocations;
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    void deallocate(T* ptr, size_t) {
+        --*allocations;
+        ::operator delete(ptr);
+    }
+};
+
+TEST(BasicSharedPtrTest, CustomDeleter) {
+    int deleted = 0;
+    {
+        BasicSharedPtr<int> sp(new int(42), [&deleted](int* ptr) {
+            ++deleted;
+            delete ptr;
+        });
+        BasicSharedPtr<int> copy = sp;
+        EXPECT_EQ(*copy, 42);
+        EXPECT_EQ(sp.UseCount(), 2);
+    }
+    EXPECT_EQ(deleted, 1);
+}
+
+TEST(BasicSharedPtrTest, DeleterForBuffer) {
+    int* buffer = new int[4]{1, 2, 3, 4};
+    BasicSharedPtr<int> sp(buffer, [](int* ptr) { delete[] ptr; });
+    EXPECT_EQ(sp.Get()[3], 4);
+}
+
+TEST(BasicSharedPtrTest, CustomAllocatorForControlBlock) {
+    size_t allocations = 0;
+    {
+        BasicSharedPtr<int> sp(new int(1), DefaultDelete<int>(), CountingAllocator<int>(&allocations));
+        EXPECT_EQ(allocations, 1);
+        BasicWeakPtr<int> wp(sp);
+        sp.Reset();
+        EXPECT_EQ(allocations, 1);  // блок жив, пока есть наблюдатели
+    }
+    EXPECT_EQ(allocations, 0);
+}
+
+TEST(BasicSharedPtrTest, AllocateSharedUsesOneAllocation) {
+    size_t allocations = 0;
+    {
+        auto sp = AllocateShared<Pair>(CountingAllocator<Pair>(&allocations), Pair{1, 2});
+        EXPECT_EQ(allocations, 1);
+        EXPECT_EQ(sp->second, 2);
+    }
+    EXPECT_EQ(allocations, 0);
+}
+
+TEST(BasicSharedPtrTest, MakeSharedGeneric) {
+    auto sp = MakeShared<Pair>(Pair{3, 4});
+    BasicWeakPtr<Pair> wp = sp;
+    EXPECT_EQ(sp->first, 3);
+    EXPECT_EQ(wp.Lock()->second, 4);
+}
+
+TEST(BasicSharedPtrTest, AliasingConstructor) {
+    BasicWeakPtr<Pair> wp;
+    BasicSharedPtr<int> second;
+    {
+        auto owner = MakeShared<Pair>(Pair{5, 6});
+        wp = owner;
+        second = BasicSharedPtr<int>(owner, &owner->second);
+        EXPECT_EQ(owner.UseCount(), 2);
+    }
+    EXPECT_EQ(*second, 6);
+    EXPECT_EQ(second.UseCount(), 1);
+    EXPECT_FALSE(wp.Expired());
+
+    second.Reset();
+    EXPECT_TRUE(wp.Expired());
+}
+
+TEST(BasicSharedPtrTest, AliasingMoveConstructor) {
+    auto owner = MakeShared<Pair>(Pair{7, 8});
+    BasicSharedPtr<int> first(std::move(owner), &owner->first);
+    EXPECT_EQ(owner.Get(), nullptr);
+    EXPECT_EQ(*first, 7);
+    EXPECT_EQ(first.UseCount(), 1);
+}
+
+TEST(BasicSharedPtrTest, PolymorphicAllocator) {
+    std::array<std::byte, 512> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                              std::pmr::null_memory_resource());
+    std::pmr::polymorphic_allocator<int> alloc(&arena);
+
+    // Объект и блок управления - одним куском из арены
+    BasicSharedPtr<int> sp = AllocateShared<int>(alloc, 42);
+    EXPECT_EQ(*sp, 42);
+    EXPECT_GE(static_cast<void*>(sp.Get()), static_cast<void*>(buffer.data()));
+    EXPECT_LT(static_cast<void*>(sp.Get()), static_cast<void*>(buffer.data() + buffer.size()));
+
+    // Блок управления для внешнего объекта тоже из арены
+    BasicSharedPtr<int> external(new int(7), DefaultDelete<int>(), alloc);
+    EXPECT_EQ(*external, 7);
+    BasicWeakPtr<int> weak(external);
+    external.Reset();
+    EXPECT_TRUE(weak.Expired());
+}
+
+// AtomicSharedPtr
+
+TEST(AtomicSharedPtrTest, LoadStore) {
+    AtomicSharedPtr<std::string> slot;
+    EXPECT_FALSE(slot.Load());
+    EXPECT_TRUE(slot.IsLockFree());
+
+    SharedPtr value = MakeShared("first");
+    slot.Store(value);
+    EXPECT_EQ(value.UseCount(), 2);
+    EXPECT_EQ(slot.Load().Get(), value.Get());
+
+    SharedPtr old = slot.Exchange(MakeShared("second"));
+    EXPECT_EQ(old.Get(), value.Get());
+    EXPECT_EQ(value.UseCount(), 2);
+    EXPECT_EQ(*slot.Load(), "second");
+}
+
+TEST(AtomicSharedPtrTest, CompareExchange) {
+    SharedPtr first = MakeShared("first");
+    AtomicSharedPtr<std::string> slot(first);
+
+    SharedPtr expected = MakeShared("other");
+    EXPECT_FALSE(slot.CompareExchange(expected, MakeShared("second")));
+    EXPECT_EQ(expected.Get(), first.Get());
+
+    EXPECT_TRUE(slot.CompareExchange(expected, MakeShared("second")));
+    EXPECT_EQ(*slot.Load(), "second");
+    EXPECT_EQ(first.UseCount(), 2);  // first и expected
+}
+
+// EpochDomain
+
+struct Tracked {
+    int* destroyed;
+
+    explicit Tracked(int* counter) : destroyed(counter) {}
+    ~Tracked() { ++*destroyed; }
+};
+
+TEST(EpochDomainTest, RetiredObjectWaitsForPinnedReader) {
+    int destroyed = 0;
+    EpochDomain domain;
+    EpochReader reader(domain);
+
+    {
+        auto guard = reader.Pin();
+        domain.Retire(new Tracked(&destroyed));
+        domain.Collect();
+        domain.Collect();
+        EXPECT_EQ(destroyed, 0);
+    }
+
+    domain.Collect();
+    domain.Collect();
+    EXPECT_EQ(destroyed, 1);
+}
+
+TEST(EpochDomainTest, NestedPins) {
+    int destroyed = 0;
+    EpochDomain domain;
+    EpochReader reader(domain);
+
+    reader.Enter();
+    reader.Enter();
+    domain.Retire(new Tracked(&destroyed));
+    reader.Exit();
+    domain.Collect();
+    domain.Collect();
+    EXPECT_EQ(destroyed, 0);
+
+    reader.Exit();
+    domain.Collect();
+    domain.Collect();
+    EXPECT_EQ(destroyed, 1);
+}
+
+TEST(EpochDomainTest, DestructorFreesRetired) {
+    int destroyed = 0;
+    {
+        EpochDomain domain;
+        domain.Retire(new Tracked(&destroyed));
+        domain.Retire(new Tracked(&destroyed));
+    }
+    EXPECT_EQ(destroyed, 2);
+}
+
+// Concurrency checks (run under ThreadSanitizer in test_smart_ptr_tsan)
+
+TEST(ConcurrencyTest, ConcurrentCopies) {
+    SharedPtr sp(new std::string("shared"));
+    const int kThreads = 4;
+    const int kIterations = 10000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([sp, kIterations]() {
+            for (int i = 0; i < kIterations; ++i) {
+                SharedPtr copy(sp);
+                WeakPtr weak(copy);
+                EXPECT_EQ(*copy, "shared");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(sp.UseCount(), 1);
+}
+
+TEST(ConcurrencyTest, LockRacesWithLastOwner) {
+    const int kRounds = 2000;
+    for (int round = 0; round < kRounds; ++round) {
+        SharedPtr sp(new std::string("value"));
+        WeakPtr wp(sp);
+
+        std::thread locker([wp]() {
+            SharedPtr locked = wp.Lock();
+            if (locked) {
+                EXPECT_EQ(*locked, "value");  // захваченный объект всегда жив
+            }
+        });
+        sp.Reset();
+        locker.join();
+
+        EXPECT_TRUE(wp.Expired());
+        EXPECT_FALSE(wp.Lock());
+    }
+}
+
+TEST(ConcurrencyTest, AtomicSharedPtrReadersAndWriter) {
+    AtomicSharedPtr<std::string> slot(MakeShared("0"));
+    std::atomic<bool> done{false};
+    const int kReaders = 3;
+    const int kUpdates = 5000;
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < kReaders; ++t) {
+        readers.emplace_back([&slot, &done]() {
+            while (!done.load(std::memory_order_acquire)) {
+                SharedPtr snapshot = slot.Load();
+                EXPECT_FALSE(snapshot->empty());
+            }
+        });
+    }
+
+    std::thread swapper([&slot]() {
+        for (int i = 0; i < kUpdates; ++i) {
+            SharedPtr expected = slot.Load();
+            slot.CompareExchange(expected, MakeShared("cas"));
+        }
+    });
+    for (int i = 1; i <= kUpdates; ++i) {
+        slot.Store(MakeShared(std::to_string(i)));
+    }
+    swapper.join();
+    done.store(true, std::memory_order_release);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(slot.Load().UseCount(), 2);
+}
+
+TEST(ConcurrencyTest, EpochReadersAndWriter) {
+    EpochDomain domain;
+    std::atomic<std::string*> current{new std::string("0")};
+    std::atomic<bool> done{false};
+    const int kReaders = 3;
+    const int kUpdates = 5000;
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < kReaders; ++t) {
+        readers.emplace_back([&domain, &current, &done]() {
+            EpochReader reader(domain);
+            while (!done.load(std::memory_order_acquire)) {
+                auto guard = reader.Pin();
+                std::string* value = current.load(std::memory_order_acquire);
+                EXPECT_FALSE(value->empty());
+            }
+        });
+    }
+
+    for (int i = 1; i <= kUpdates; ++i) {
+        std::string* old = current.exchange(new std::string(std::to_string(i)),
+                                            std::memory_order_acq_rel);
+        domain.Retire(old);
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    domain.Retire(current.load());
+}
+
 // Compile-time checks
 
 TEST(CompileTimeTest, CopyOperationsAvailable) {
@@ -710,4 +1052,4 @@ TEST(CompileTimeTest, MoveOperationsAvailable) {
         "WeakPtr should be move constructible");
     static_assert(std::is_move_assignable_v<WeakPtr>,
         "WeakPtr should be move assignable");
-}
\ No newline at end of file
+}
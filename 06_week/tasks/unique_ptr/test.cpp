@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <cstdlib>
 
 #include "unique_ptr.cpp"
 
@@ -204,4 +205,95 @@ TEST(UniquePtrTest, OwnershipAfterMove) {
     EXPECT_EQ(ptr2.Get(), raw);
     EXPECT_EQ(ptr2->data(), expected_str);
     EXPECT_EQ(*ptr2, "test");
-}
\ No newline at end of file
+}
+
+// Generic BasicUniquePtr<T, Deleter>
+
+struct CountingDelete {
+    int* deleted;
+
+    void operator()(int* ptr) const {
+        ++*deleted;
+        delete ptr;
+    }
+};
+
+void FreeBuffer(char* ptr) {
+    std::free(ptr);
+}
+
+TEST(BasicUniquePtrTest, StatelessDeleterIsZeroSize) {
+    static_assert(sizeof(UniquePtr) == sizeof(std::string*));
+    static_assert(sizeof(BasicUniquePtr<int[]>) == sizeof(int*));
+    static_assert(sizeof(BasicUniquePtr<int, CountingDelete>) == 2 * sizeof(int*));
+}
+
+TEST(BasicUniquePtrTest, FunctionPointerDeleterRequiresExplicitDeleter) {
+    // Нулевой указатель на функцию не подставляется по умолчанию
+    using FreePtr = BasicUniquePtr<char, void (*)(char*)>;
+    static_assert(!std::is_default_constructible_v<FreePtr>);
+    static_assert(!std::is_constructible_v<FreePtr, std::nullptr_t>);
+    static_assert(!std::is_constructible_v<FreePtr, char*>);
+    static_assert(std::is_constructible_v<FreePtr, char*, void (*)(char*)>);
+
+    using FreeArrayPtr = BasicUniquePtr<char[], void (*)(char*)>;
+    static_assert(!std::is_default_constructible_v<FreeArrayPtr>);
+    static_assert(!std::is_constructible_v<FreeArrayPtr, std::nullptr_t>);
+    static_assert(!std::is_constructible_v<FreeArrayPtr, char*>);
+    static_assert(std::is_constructible_v<FreeArrayPtr, char*, void (*)(char*)>);
+
+    static_assert(std::is_default_constructible_v<BasicUniquePtr<int, CountingDelete>>);
+}
+
+TEST(BasicUniquePtrTest, CustomDeleter) {
+    int deleted = 0;
+    {
+        BasicUniquePtr<int, CountingDelete> ptr(new int(1), CountingDelete{&deleted});
+        ptr.Reset(new int(2));
+        EXPECT_EQ(deleted, 1);
+        EXPECT_EQ(*ptr, 2);
+
+        BasicUniquePtr<int, CountingDelete> other(std::move(ptr));
+        EXPECT_EQ(ptr.Get(), nullptr);
+        EXPECT_EQ(deleted, 1);
+    }
+    EXPECT_EQ(deleted, 2);
+}
+
+TEST(BasicUniquePtrTest, FreeBackedBuffer) {
+    auto* raw = static_cast<char*>(std::malloc(16));
+    BasicUniquePtr<char, void (*)(char*)> buffer(raw, &FreeBuffer);
+    buffer.Get()[0] = 'x';
+    EXPECT_EQ(*buffer, 'x');
+    EXPECT_EQ(buffer.GetDeleter(), &FreeBuffer);
+}
+
+TEST(BasicUniquePtrTest, ArrayForm) {
+    BasicUniquePtr<int[]> array(new int[3]{1, 2, 3});
+    EXPECT_EQ(array[2], 3);
+    array[0] = 10;
+    EXPECT_EQ(array.Get()[0], 10);
+
+    BasicUniquePtr<int[]> other;
+    other = std::move(array);
+    EXPECT_FALSE(array);
+    EXPECT_EQ(other[1], 2);
+
+    other.Reset(new int[1]{42});
+    EXPECT_EQ(other[0], 42);
+}
+
+struct Base {
+    virtual ~Base() = default;
+};
+
+struct Derived : Base {
+    std::string name = "derived";
+};
+
+TEST(BasicUniquePtrTest, ConvertingMove) {
+    BasicUniquePtr<Derived> derived(new Derived());
+    BasicUniquePtr<Base> base(std::move(derived));
+    EXPECT_EQ(derived.Get(), nullptr);
+    EXPECT_EQ(static_cast<Derived*>(base.Get())->name, "derived");
+}
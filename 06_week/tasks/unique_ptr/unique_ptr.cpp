@@ -1,101 +1,337 @@
 #include <string>
+#include <cstddef>
+#include <concepts>
+#include <type_traits>
 #include <utility> // для std::move
 
-class UniquePtr {
+// Удалитель по умолчанию - обычный delete
+template<typename T>
+struct DefaultDelete {
+    DefaultDelete() = default;
+    template<typename U> requires std::convertible_to<U*, T*>
+    DefaultDelete(const DefaultDelete<U>&) {}
+
+    void operator()(T* ptr) const;
+};
+
+// Удалитель по умолчанию для массивов - delete[]
+template<typename T>
+struct DefaultDelete<T[]> {
+    void operator()(T* ptr) const;
+};
+
+template<typename T>
+void DefaultDelete<T>::operator()(T* ptr) const {
+    delete ptr;
+}
+
+template<typename T>
+void DefaultDelete<T[]>::operator()(T* ptr) const {
+    delete[] ptr;
+}
+
+// Удалитель, который можно создать по умолчанию. Указатель на функцию
+// по умолчанию нулевой, поэтому его нужно передавать явно
+template<typename Deleter>
+concept DefaultConstructibleDeleter = std::is_default_constructible_v<Deleter> && !std::is_pointer_v<Deleter>;
+
+// Класс BasicUniquePtr - умный указатель с единоличным владением объектом типа T.
+// Удалитель хранится как [[no_unique_address]] член (пустая база в терминах C++20):
+// у удалителя без состояния размер указателя равен размеру сырого указателя
+template<typename T, typename Deleter = DefaultDelete<T>>
+class BasicUniquePtr {
 private:
-    std::string* ptr_;
+    T* ptr_;
+    [[no_unique_address]] Deleter deleter_;
+
+    template<typename U, typename E>
+    friend class BasicUniquePtr;
 
 public:
     // Конструкторы
-    UniquePtr();
-    explicit UniquePtr(std::string* ptr);
-    
-    UniquePtr(const UniquePtr&) = delete;
-    UniquePtr& operator=(const UniquePtr&) = delete;
-    
-    UniquePtr(UniquePtr&& other) noexcept;
-    UniquePtr& operator=(UniquePtr&& other);
-    
+    BasicUniquePtr() requires DefaultConstructibleDeleter<Deleter>;
+    BasicUniquePtr(std::nullptr_t) requires DefaultConstructibleDeleter<Deleter>;
+    explicit BasicUniquePtr(T* ptr) requires DefaultConstructibleDeleter<Deleter>;
+    BasicUniquePtr(T* ptr, Deleter deleter);
+
+    BasicUniquePtr(const BasicUniquePtr&) = delete;
+    BasicUniquePtr& operator=(const BasicUniquePtr&) = delete;
+
+    BasicUniquePtr(BasicUniquePtr&& other) noexcept;
+    BasicUniquePtr& operator=(BasicUniquePtr&& other) noexcept;
+
+    // Перемещение из указателя на совместимый тип (например, наследника)
+    template<typename U, typename E> requires std::convertible_to<U*, T*>
+    BasicUniquePtr(BasicUniquePtr<U, E>&& other) noexcept;
+
     // Деструктор
-    ~UniquePtr();
-    
+    ~BasicUniquePtr();
+
     // Операторы
-    std::string& operator*() const;
-    std::string* operator->() const;
+    T& operator*() const;
+    T* operator->() const;
     explicit operator bool() const;
-    
-    // Методы
-    std::string* Get() const;
-    std::string* Release();
-    void Reset(std::string* new_ptr = nullptr);
-    void Swap(UniquePtr& other) noexcept;
 
+    // Методы
+    T* Get() const;
+    Deleter& GetDeleter();
+    const Deleter& GetDeleter() const;
+    T* Release();
+    void Reset(T* new_ptr = nullptr);
+    void Swap(BasicUniquePtr& other) noexcept;
 };
 
 // Конструктор по умолчанию
-UniquePtr::UniquePtr() : ptr_(nullptr) {}
+template<typename T, typename Deleter>
+BasicUniquePtr<T, Deleter>::BasicUniquePtr() requires DefaultConstructibleDeleter<Deleter>
+    : ptr_(nullptr), deleter_() {}
+
+// Конструктор от nullptr
+template<typename T, typename Deleter>
+BasicUniquePtr<T, Deleter>::BasicUniquePtr(std::nullptr_t) requires DefaultConstructibleDeleter<Deleter>
+    : BasicUniquePtr() {}
 
 // Конструктор от сырого указателя
-UniquePtr::UniquePtr(std::string* ptr) : ptr_(ptr) {}
+template<typename T, typename Deleter>
+BasicUniquePtr<T, Deleter>::BasicUniquePtr(T* ptr) requires DefaultConstructibleDeleter<Deleter>
+    : ptr_(ptr), deleter_() {}
+
+// Конструктор от сырого указателя с удалителем
+template<typename T, typename Deleter>
+BasicUniquePtr<T, Deleter>::BasicUniquePtr(T* ptr, Deleter deleter)
+    : ptr_(ptr), deleter_(std::move(deleter)) {}
 
 // Перемещающий конструктор
-UniquePtr::UniquePtr(UniquePtr&& other) noexcept : ptr_(other.ptr_) {
+template<typename T, typename Deleter>
+BasicUniquePtr<T, Deleter>::BasicUniquePtr(BasicUniquePtr&& other) noexcept
+    : ptr_(other.ptr_), deleter_(std::move(other.deleter_)) {
+    other.ptr_ = nullptr;
+}
+
+// Перемещающий конструктор из указателя на совместимый тип
+template<typename T, typename Deleter>
+template<typename U, typename E> requires std::convertible_to<U*, T*>
+BasicUniquePtr<T, Deleter>::BasicUniquePtr(BasicUniquePtr<U, E>&& other) noexcept
+    : ptr_(other.ptr_), deleter_(std::move(other.deleter_)) {
     other.ptr_ = nullptr;
 }
 
 // Перемещающее присваивание
-UniquePtr& UniquePtr::operator=(UniquePtr&& other) {
+template<typename T, typename Deleter>
+BasicUniquePtr<T, Deleter>& BasicUniquePtr<T, Deleter>::operator=(BasicUniquePtr&& other) noexcept {
     if (this != &other) {
-        delete ptr_;
-        ptr_ = other.ptr_;
-        other.ptr_ = nullptr;
+        Reset(other.Release());
+        deleter_ = std::move(other.deleter_);
     }
     return *this;
 }
 
 // Деструктор
-UniquePtr::~UniquePtr() {
-    delete ptr_;
+template<typename T, typename Deleter>
+BasicUniquePtr<T, Deleter>::~BasicUniquePtr() {
+    if (ptr_) {
+        deleter_(ptr_);
+    }
 }
 
 // Оператор разыменования
-std::string& UniquePtr::operator*() const {
+template<typename T, typename Deleter>
+T& BasicUniquePtr<T, Deleter>::operator*() const {
     return *ptr_;
 }
 
 // Оператор доступа к членам
-std::string* UniquePtr::operator->() const {
+template<typename T, typename Deleter>
+T* BasicUniquePtr<T, Deleter>::operator->() const {
+    return ptr_;
+}
+
+// Оператор преобразования к bool
+template<typename T, typename Deleter>
+BasicUniquePtr<T, Deleter>::operator bool() const {
+    return ptr_ != nullptr;
+}
+
+// Получить сырой указатель
+template<typename T, typename Deleter>
+T* BasicUniquePtr<T, Deleter>::Get() const {
     return ptr_;
 }
 
+// Получить удалитель
+template<typename T, typename Deleter>
+Deleter& BasicUniquePtr<T, Deleter>::GetDeleter() {
+    return deleter_;
+}
+
+template<typename T, typename Deleter>
+const Deleter& BasicUniquePtr<T, Deleter>::GetDeleter() const {
+    return deleter_;
+}
+
+// Освободить владение
+template<typename T, typename Deleter>
+T* BasicUniquePtr<T, Deleter>::Release() {
+    T* temp = ptr_;
+    ptr_ = nullptr;
+    return temp;
+}
+
+// Сбросить указатель. Старый объект удаляется после замены указателя
+template<typename T, typename Deleter>
+void BasicUniquePtr<T, Deleter>::Reset(T* new_ptr) {
+    T* old = ptr_;
+    ptr_ = new_ptr;
+    if (old) {
+        deleter_(old);
+    }
+}
+
+// Обмен с другим UniquePtr
+template<typename T, typename Deleter>
+void BasicUniquePtr<T, Deleter>::Swap(BasicUniquePtr& other) noexcept {
+    std::swap(ptr_, other.ptr_);
+    std::swap(deleter_, other.deleter_);
+}
+
+// Специализация для массивов: вместо * и -> доступ по индексу, удаление через delete[]
+template<typename T, typename Deleter>
+class BasicUniquePtr<T[], Deleter> {
+private:
+    T* ptr_;
+    [[no_unique_address]] Deleter deleter_;
+
+public:
+    // Конструкторы
+    BasicUniquePtr() requires DefaultConstructibleDeleter<Deleter>;
+    BasicUniquePtr(std::nullptr_t) requires DefaultConstructibleDeleter<Deleter>;
+    explicit BasicUniquePtr(T* ptr) requires DefaultConstructibleDeleter<Deleter>;
+    BasicUniquePtr(T* ptr, Deleter deleter);
+
+    BasicUniquePtr(const BasicUniquePtr&) = delete;
+    BasicUniquePtr& operator=(const BasicUniquePtr&) = delete;
+
+    BasicUniquePtr(BasicUniquePtr&& other) noexcept;
+    BasicUniquePtr& operator=(BasicUniquePtr&& other) noexcept;
+
+    // Деструктор
+    ~BasicUniquePtr();
+
+    // Операторы
+    T& operator[](std::size_t index) const;
+    explicit operator bool() const;
+
+    // Методы
+    T* Get() const;
+    Deleter& GetDeleter();
+    const Deleter& GetDeleter() const;
+    T* Release();
+    void Reset(T* new_ptr = nullptr);
+    void Swap(BasicUniquePtr& other) noexcept;
+};
+
+// Конструктор по умолчанию
+template<typename T, typename Deleter>
+BasicUniquePtr<T[], Deleter>::BasicUniquePtr() requires DefaultConstructibleDeleter<Deleter>
+    : ptr_(nullptr), deleter_() {}
+
+// Конструктор от nullptr
+template<typename T, typename Deleter>
+BasicUniquePtr<T[], Deleter>::BasicUniquePtr(std::nullptr_t) requires DefaultConstructibleDeleter<Deleter>
+    : BasicUniquePtr() {}
+
+// Конструктор от сырого указателя на массив
+template<typename T, typename Deleter>
+BasicUniquePtr<T[], Deleter>::BasicUniquePtr(T* ptr) requires DefaultConstructibleDeleter<Deleter>
+    : ptr_(ptr), deleter_() {}
+
+// Конструктор от сырого указателя на массив с удалителем
+template<typename T, typename Deleter>
+BasicUniquePtr<T[], Deleter>::BasicUniquePtr(T* ptr, Deleter deleter)
+    : ptr_(ptr), deleter_(std::move(deleter)) {}
+
+// Перемещающий конструктор
+template<typename T, typename Deleter>
+BasicUniquePtr<T[], Deleter>::BasicUniquePtr(BasicUniquePtr&& other) noexcept
+    : ptr_(other.ptr_), deleter_(std::move(other.deleter_)) {
+    other.ptr_ = nullptr;
+}
+
+// Перемещающее присваивание
+template<typename T, typename Deleter>
+BasicUniquePtr<T[], Deleter>& BasicUniquePtr<T[], Deleter>::operator=(BasicUniquePtr&& other) noexcept {
+    if (this != &other) {
+        Reset(other.Release());
+        deleter_ = std::move(other.deleter_);
+    }
+    return *this;
+}
+
+// Деструктор
+template<typename T, typename Deleter>
+BasicUniquePtr<T[], Deleter>::~BasicUniquePtr() {
+    if (ptr_) {
+        deleter_(ptr_);
+    }
+}
+
+// Доступ к элементу массива
+template<typename T, typename Deleter>
+T& BasicUniquePtr<T[], Deleter>::operator[](std::size_t index) const {
+    return ptr_[index];
+}
+
 // Оператор преобразования к bool
-UniquePtr::operator bool() const {
+template<typename T, typename Deleter>
+BasicUniquePtr<T[], Deleter>::operator bool() const {
     return ptr_ != nullptr;
 }
 
 // Получить сырой указатель
-std::string* UniquePtr::Get() const {
+template<typename T, typename Deleter>
+T* BasicUniquePtr<T[], Deleter>::Get() const {
     return ptr_;
 }
 
+// Получить удалитель
+template<typename T, typename Deleter>
+Deleter& BasicUniquePtr<T[], Deleter>::GetDeleter() {
+    return deleter_;
+}
+
+template<typename T, typename Deleter>
+const Deleter& BasicUniquePtr<T[], Deleter>::GetDeleter() const {
+    return deleter_;
+}
+
 // Освободить владение
-std::string* UniquePtr::Release() {
-    std::string* temp = ptr_;
+template<typename T, typename Deleter>
+T* BasicUniquePtr<T[], Deleter>::Release() {
+    T* temp = ptr_;
     ptr_ = nullptr;
     return temp;
 }
 
-// Сбросить указатель
-void UniquePtr::Reset(std::string* new_ptr) {
-    delete ptr_;
+// Сбросить указатель. Старый массив удаляется после замены указателя
+template<typename T, typename Deleter>
+void BasicUniquePtr<T[], Deleter>::Reset(T* new_ptr) {
+    T* old = ptr_;
     ptr_ = new_ptr;
+    if (old) {
+        deleter_(old);
+    }
 }
 
 // Обмен с другим UniquePtr
-void UniquePtr::Swap(UniquePtr& other) noexcept {
+template<typename T, typename Deleter>
+void BasicUniquePtr<T[], Deleter>::Swap(BasicUniquePtr& other) noexcept {
     std::swap(ptr_, other.ptr_);
+    std::swap(deleter_, other.deleter_);
 }
 
+// Указатель на строку - основной вариант использования
+using UniquePtr = BasicUniquePtr<std::string>;
+
 // Функция MakeUnique с поддержкой копирования и перемещения
 UniquePtr MakeUnique(const std::string& str) {
     return UniquePtr(new std::string(str));
@@ -106,6 +342,7 @@ UniquePtr MakeUnique(std::string&& str) {
 }
 
 // Функция Swap для обмена умными указателями
-void Swap(UniquePtr& first, UniquePtr& second) noexcept {
+template<typename T, typename Deleter>
+void Swap(BasicUniquePtr<T, Deleter>& first, BasicUniquePtr<T, Deleter>& second) noexcept {
     first.Swap(second);
-}
\ No newline at end of file
+}
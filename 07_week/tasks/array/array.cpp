@@ -1,64 +1,79 @@
 #include <initializer_list>
 #include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
-template<typename T, std::size_t N>
+// Массив на стеке. Все операции constexpr. Копирование, перемещение и
+// деструктор задаются по умолчанию прямо в объявлении, поэтому для тривиального T
+// массив тривиально копируемый и копируется как memcpy.
+// Align - выравнивание хранилища, например Array<float, 16, 32> можно читать
+// выровненными AVX-загрузками
+template<typename T, std::size_t N, std::size_t Align = alignof(T)>
 class Array {
+    static_assert(Align >= alignof(T), "Alignment is weaker than alignof(T)");
+    static_assert((Align & (Align - 1)) == 0, "Alignment must be a power of two");
+
 private:
-    T data_[N];
+    alignas(Align) T data_[N];
 
 public:
     // Конструкторы
-    Array();
-    Array(std::initializer_list<T> init);
-    Array(const Array& other);
-    Array(Array&& other) noexcept;
-    
+    constexpr Array() = default;
+    constexpr Array(std::initializer_list<T> init);
+    constexpr Array(const Array& other) = default;
+    constexpr Array(Array&& other) noexcept = default;
+
     // Операторы присваивания
-    Array& operator=(const Array& other);
-    Array& operator=(Array&& other) noexcept;
-    
+    constexpr Array& operator=(const Array& other) = default;
+    constexpr Array& operator=(Array&& other) noexcept = default;
+
     // Деструктор
-    ~Array();
-    
+    constexpr ~Array() = default;
+
     // Операторы индексирования
-    T& operator[](std::size_t index);
-    const T& operator[](std::size_t index) const;
-    
+    constexpr T& operator[](std::size_t index);
+    constexpr const T& operator[](std::size_t index) const;
+
     // Методы
-    T& Front();
-    const T& Front() const;
- 
-    T& Back();
-    const T& Back() const;
-    
-    T* Data();
-    const T* Data() const;
-    
-    bool Empty() const;
-    
-    std::size_t Size() const;
-    
-    void Fill(const T& value);
-    
-    void Swap(Array& other);
-    
+    constexpr T& Front();
+    constexpr const T& Front() const;
+
+    constexpr T& Back();
+    constexpr const T& Back() const;
+
+    constexpr T* Data();
+    constexpr const T* Data() const;
+
+    constexpr bool Empty() const;
+
+    constexpr std::size_t Size() const;
+
+    constexpr void Fill(const T& value);
+
+    constexpr void Swap(Array& other);
+
     // Итераторы
-    T* begin();
-    const T* begin() const;
-    T* end();
-    const T* end() const;
-    
-    const T* cbegin() const;
-    const T* cend() const;
+    constexpr T* begin();
+    constexpr const T* begin() const;
+    constexpr T* end();
+    constexpr const T* end() const;
+
+    constexpr const T* cbegin() const;
+    constexpr const T* cend() const;
 };
 
 // Конструкторы
-template<typename T, std::size_t N>
-Array<T, N>::Array() = default;
-
-template<typename T, std::size_t N>
-Array<T, N>::Array(std::initializer_list<T> init) {
+// Все элементы сначала value-initialized, затем первые заполняются из списка
+template<typename T, std::size_t N, std::size_t Align>
+constexpr Array<T, N, Align>::Array(std::initializer_list<T> init) : data_{} {
     std::size_t i = 0;
     for (auto& item : init) {
         if (i < N) {
@@ -66,171 +81,127 @@ Array<T, N>::Array(std::initializer_list<T> init) {
             ++i;
         }
     }
-    // Оставшиеся элементы будут value-initialized
-}
-
-template<typename T, std::size_t N>
-Array<T, N>::Array(const Array& other) {
-    for (std::size_t i = 0; i < N; ++i) {
-        data_[i] = other.data_[i];
-    }
 }
 
-template<typename T, std::size_t N>
-Array<T, N>::Array(Array&& other) noexcept {
-    for (std::size_t i = 0; i < N; ++i) {
-        data_[i] = std::move(other.data_[i]);
-    }
-}
-
-// Операторы присваивания
-template<typename T, std::size_t N>
-Array<T, N>& Array<T, N>::operator=(const Array& other) {
-    if (this != &other) {
-        for (std::size_t i = 0; i < N; ++i) {
-            data_[i] = other.data_[i];
-        }
-    }
-    return *this;
-}
-
-template<typename T, std::size_t N>
-Array<T, N>& Array<T, N>::operator=(Array&& other) noexcept {
-    if (this != &other) {
-        for (std::size_t i = 0; i < N; ++i) {
-            data_[i] = std::move(other.data_[i]);
-        }
-    }
-    return *this;
-}
-
-// Деструктор
-template<typename T, std::size_t N>
-Array<T, N>::~Array() = default;
-
 // Операторы индексирования (только один раз!)
-template<typename T, std::size_t N>
-T& Array<T, N>::operator[](std::size_t index) {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr T& Array<T, N, Align>::operator[](std::size_t index) {
     return data_[index];
 }
 
-template<typename T, std::size_t N>
-const T& Array<T, N>::operator[](std::size_t index) const {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr const T& Array<T, N, Align>::operator[](std::size_t index) const {
     return data_[index];
 }
 
 // Получение первого элемента - можно изменять
-template<typename T, std::size_t N>
-T& Array<T, N>::Front() {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr T& Array<T, N, Align>::Front() {
     return data_[0];
 }
 
 // Получение первого элемента - только для чтения
-template<typename T, std::size_t N>
-const T& Array<T, N>::Front() const {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr const T& Array<T, N, Align>::Front() const {
     return data_[0];
 }
 
 // Получение последнего элемента - можно изменять
-template<typename T, std::size_t N>
-T& Array<T, N>::Back() {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr T& Array<T, N, Align>::Back() {
     return data_[N - 1];
 }
 
 // Получение последнего элемента - только для чтения
-template<typename T, std::size_t N>
-const T& Array<T, N>::Back() const {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr const T& Array<T, N, Align>::Back() const {
     return data_[N - 1];
 }
 
 // Получение сырого указателя на данные - можно изменять через указатель
-template<typename T, std::size_t N>
-T* Array<T, N>::Data() {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr T* Array<T, N, Align>::Data() {
     return data_;
 }
 
 // Получение сырого указателя на данные - данные только для чтения
-template<typename T, std::size_t N>
-const T* Array<T, N>::Data() const {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr const T* Array<T, N, Align>::Data() const {
     return data_;
 }
 
 // Проверка на пустоту - true если размер 0
-template<typename T, std::size_t N>
-bool Array<T, N>::Empty() const {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr bool Array<T, N, Align>::Empty() const {
     return N == 0;
 }
 
 // Получение размера массива (константное время)
-template<typename T, std::size_t N>
-std::size_t Array<T, N>::Size() const {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr std::size_t Array<T, N, Align>::Size() const {
     return N;
 }
 
 // Заполнение всего массива одним значением
-template<typename T, std::size_t N>
-void Array<T, N>::Fill(const T& value) {
-    for (std::size_t i = 0; i < N; ++i) {
-        data_[i] = value;
-    }
+template<typename T, std::size_t N, std::size_t Align>
+constexpr void Array<T, N, Align>::Fill(const T& value) {
+    std::fill(data_, data_ + N, value);
 }
 
 // Обмен содержимым с другим массивом (поэлементный swap)
-template<typename T, std::size_t N>
-void Array<T, N>::Swap(Array& other) {
-    for (std::size_t i = 0; i < N; ++i) {
-        std::swap(data_[i], other.data_[i]);
-    }
+template<typename T, std::size_t N, std::size_t Align>
+constexpr void Array<T, N, Align>::Swap(Array& other) {
+    std::swap_ranges(data_, data_ + N, other.data_);
 }
 
 // Итераторы
-template<typename T, std::size_t N>
-T* Array<T, N>::begin() {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr T* Array<T, N, Align>::begin() {
     return data_;
 }
 
-template<typename T, std::size_t N>
-const T* Array<T, N>::begin() const {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr const T* Array<T, N, Align>::begin() const {
     return data_;
 }
 
-template<typename T, std::size_t N>
-T* Array<T, N>::end() {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr T* Array<T, N, Align>::end() {
     return data_ + N;
 }
 
-template<typename T, std::size_t N>
-const T* Array<T, N>::end() const {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr const T* Array<T, N, Align>::end() const {
     return data_ + N;
 }
 
 // Const итераторы
-template<typename T, std::size_t N>
-const T* Array<T, N>::cbegin() const {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr const T* Array<T, N, Align>::cbegin() const {
     return data_;
 }
 
-template<typename T, std::size_t N>
-const T* Array<T, N>::cend() const {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr const T* Array<T, N, Align>::cend() const {
     return data_ + N;
 }
 
 // Операторы сравнения
-template<typename T, std::size_t N>
-bool operator==(const Array<T, N>& lhs, const Array<T, N>& rhs) {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr bool operator==(const Array<T, N, Align>& lhs, const Array<T, N, Align>& rhs) {
     for (std::size_t i = 0; i < N; ++i) {
         if (lhs[i] != rhs[i]) return false;
     }
     return true;
 }
 
-template<typename T, std::size_t N>
-bool operator!=(const Array<T, N>& lhs, const Array<T, N>& rhs) {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr bool operator!=(const Array<T, N, Align>& lhs, const Array<T, N, Align>& rhs) {
     return !(lhs == rhs);
 }
 
-template<typename T, std::size_t N>
-bool operator<(const Array<T, N>& lhs, const Array<T, N>& rhs) {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr bool operator<(const Array<T, N, Align>& lhs, const Array<T, N, Align>& rhs) {
     for (std::size_t i = 0; i < N; ++i) {
         if (lhs[i] < rhs[i]) return true;
         if (rhs[i] < lhs[i]) return false;
@@ -238,44 +209,436 @@ bool operator<(const Array<T, N>& lhs, const Array<T, N>& rhs) {
     return false;
 }
 
-template<typename T, std::size_t N>
-bool operator<=(const Array<T, N>& lhs, const Array<T, N>& rhs) {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr bool operator<=(const Array<T, N, Align>& lhs, const Array<T, N, Align>& rhs) {
     return !(rhs < lhs);
 }
 
-template<typename T, std::size_t N>
-bool operator>(const Array<T, N>& lhs, const Array<T, N>& rhs) {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr bool operator>(const Array<T, N, Align>& lhs, const Array<T, N, Align>& rhs) {
     return rhs < lhs;
 }
 
-template<typename T, std::size_t N>
-bool operator>=(const Array<T, N>& lhs, const Array<T, N>& rhs) {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr bool operator>=(const Array<T, N, Align>& lhs, const Array<T, N, Align>& rhs) {
     return !(lhs < rhs);
 }
 
 // Внешняя функция для обмена содержимым двух массивов
-template<typename T, std::size_t N>
-void swap(Array<T, N>& lhs, Array<T, N>& rhs) {
+template<typename T, std::size_t N, std::size_t Align>
+constexpr void swap(Array<T, N, Align>& lhs, Array<T, N, Align>& rhs) {
     lhs.Swap(rhs);
 }
 
 // Доступ к элементу по индексу I (шаблонный параметр) для обычного массива
-template<std::size_t I, typename T, std::size_t N>
-T& get(Array<T, N>& arr) {
+template<std::size_t I, typename T, std::size_t N, std::size_t Align>
+constexpr T& get(Array<T, N, Align>& arr) {
     static_assert(I < N, "Index out of bounds");
     return arr[I];
 }
 
 // Доступ к элементу по индексу I для константного массива
-template<std::size_t I, typename T, std::size_t N>
-const T& get(const Array<T, N>& arr) {
+template<std::size_t I, typename T, std::size_t N, std::size_t Align>
+constexpr const T& get(const Array<T, N, Align>& arr) {
     static_assert(I < N, "Index out of bounds");
     return arr[I];
 }
 
 // Доступ к элементу по индексу I для временного массива (move-семантика)
-template<std::size_t I, typename T, std::size_t N>
-T&& get(Array<T, N>&& arr) {
+template<std::size_t I, typename T, std::size_t N, std::size_t Align>
+constexpr T&& get(Array<T, N, Align>&& arr) {
     static_assert(I < N, "Index out of bounds");
     return std::move(arr[I]);
-}
\ No newline at end of file
+}
+
+// Поэлементная арифметика (expression templates).
+// Выражение a * b + c не создает промежуточных массивов: операции строят
+// легкие узлы ElementwiseExpr, а вычисление идет одним проходом при
+// присваивании в Array. Массивы в узлах хранятся по ссылке, поэтому выражение
+// нужно вычислить, пока живут его операнды (обычно в том же выражении)
+
+// До этого размера циклы вычисления раскрываются на этапе компиляции
+inline constexpr std::size_t kArrayUnrollLimit = 16;
+
+// Свойства операнда: тип элемента и размер
+template<typename E>
+struct OperandTraits {
+    static constexpr bool kIsOperand = false;
+};
+
+template<typename T, std::size_t N, std::size_t Align>
+struct OperandTraits<Array<T, N, Align>> {
+    static constexpr bool kIsOperand = true;
+    using ValueType = T;
+    static constexpr std::size_t kSize = N;
+};
+
+template<typename E>
+concept ArrayOperand = OperandTraits<std::remove_cvref_t<E>>::kIsOperand;
+
+// Операнды одного размера и типа элементов
+template<typename L, typename R>
+concept SameShape = ArrayOperand<L> && ArrayOperand<R> &&
+    OperandTraits<std::remove_cvref_t<L>>::kSize == OperandTraits<std::remove_cvref_t<R>>::kSize &&
+    std::same_as<typename OperandTraits<std::remove_cvref_t<L>>::ValueType,
+                 typename OperandTraits<std::remove_cvref_t<R>>::ValueType>;
+
+// Скаляр в выражении - одно значение для всех индексов
+template<typename T>
+struct ScalarOperand {
+    T value;
+
+    constexpr const T& operator[](std::size_t) const;
+};
+
+template<typename T>
+constexpr const T& ScalarOperand<T>::operator[](std::size_t) const {
+    return value;
+}
+
+// Массивы хранятся по ссылке, узлы выражений и скаляры - по значению
+template<typename E>
+using OperandStorage = std::conditional_t<OperandTraits<E>::kIsOperand &&
+                                          !requires { typename E::IsExpression; },
+                                          const E&, E>;
+
+// Узел выражения: операция Op над элементами операндов с одним индексом
+template<typename T, std::size_t N, typename Op, typename... Operands>
+class ElementwiseExpr {
+private:
+    [[no_unique_address]] Op op_;
+    std::tuple<OperandStorage<Operands>...> operands_;
+
+public:
+    using IsExpression = void;
+
+    constexpr ElementwiseExpr(Op op, const Operands&... operands);
+
+    constexpr T operator[](std::size_t index) const;
+
+    // Вычисление в массив с любым выравниванием
+    template<std::size_t Align>
+    constexpr operator Array<T, N, Align>() const;
+};
+
+template<typename T, std::size_t N, typename Op, typename... Operands>
+struct OperandTraits<ElementwiseExpr<T, N, Op, Operands...>> {
+    static constexpr bool kIsOperand = true;
+    using ValueType = T;
+    static constexpr std::size_t kSize = N;
+};
+
+// Применяет функцию к каждому индексу 0..N-1: для малых N - развернуто
+template<std::size_t N, typename Function>
+constexpr void ForEachIndex(Function&& function) {
+    if constexpr (N <= kArrayUnrollLimit) {
+        [&function]<std::size_t... I>(std::index_sequence<I...>) {
+            (function(I), ...);
+        }(std::make_index_sequence<N>{});
+    } else {
+        for (std::size_t i = 0; i < N; ++i) {
+            function(i);
+        }
+    }
+}
+
+template<typename T, std::size_t N, typename Op, typename... Operands>
+constexpr ElementwiseExpr<T, N, Op, Operands...>::ElementwiseExpr(Op op, const Operands&... operands)
+    : op_(op), operands_(operands...) {}
+
+template<typename T, std::size_t N, typename Op, typename... Operands>
+constexpr T ElementwiseExpr<T, N, Op, Operands...>::operator[](std::size_t index) const {
+    return std::apply([this, index](const auto&... operands) {
+        return static_cast<T>(op_(operands[index]...));
+    }, operands_);
+}
+
+template<typename T, std::size_t N, typename Op, typename... Operands>
+template<std::size_t Align>
+constexpr ElementwiseExpr<T, N, Op, Operands...>::operator Array<T, N, Align>() const {
+    Array<T, N, Align> result;
+    ForEachIndex<N>([&result, this](std::size_t i) {
+        result[i] = (*this)[i];
+    });
+    return result;
+}
+
+// Создает узел выражения с типом и размером операндов
+template<typename Op, typename First, typename... Rest>
+constexpr auto MakeElementwise(Op op, const First& first, const Rest&... rest) {
+    using Traits = OperandTraits<First>;
+    return ElementwiseExpr<typename Traits::ValueType, Traits::kSize, Op, First, Rest...>(
+        op, first, rest...);
+}
+
+// Умножение-сложение a * b + c одной операцией (std::fma для вещественных)
+struct FusedMultiplyAdd {
+    template<typename T>
+    constexpr T operator()(const T& a, const T& b, const T& c) const;
+};
+
+template<typename T>
+constexpr T FusedMultiplyAdd::operator()(const T& a, const T& b, const T& c) const {
+    if constexpr (std::is_floating_point_v<T>) {
+        if (!std::is_constant_evaluated()) {
+            return std::fma(a, b, c);
+        }
+    }
+    return a * b + c;
+}
+
+// Поэлементные операторы над массивами и выражениями
+template<typename L, typename R> requires SameShape<L, R>
+constexpr auto operator+(const L& lhs, const R& rhs) {
+    return MakeElementwise(std::plus<>(), lhs, rhs);
+}
+
+template<typename L, typename R> requires SameShape<L, R>
+constexpr auto operator-(const L& lhs, const R& rhs) {
+    return MakeElementwise(std::minus<>(), lhs, rhs);
+}
+
+template<typename L, typename R> requires SameShape<L, R>
+constexpr auto operator*(const L& lhs, const R& rhs) {
+    return MakeElementwise(std::multiplies<>(), lhs, rhs);
+}
+
+template<typename L, typename R> requires SameShape<L, R>
+constexpr auto operator/(const L& lhs, const R& rhs) {
+    return MakeElementwise(std::divides<>(), lhs, rhs);
+}
+
+// Операции со скаляром
+template<ArrayOperand E>
+constexpr auto operator*(const E& expr, typename OperandTraits<E>::ValueType scalar) {
+    using T = typename OperandTraits<E>::ValueType;
+    return MakeElementwise(std::multiplies<>(), expr, ScalarOperand<T>{scalar});
+}
+
+template<ArrayOperand E>
+constexpr auto operator*(typename OperandTraits<E>::ValueType scalar, const E& expr) {
+    return expr * scalar;
+}
+
+template<ArrayOperand E>
+constexpr auto operator/(const E& expr, typename OperandTraits<E>::ValueType scalar) {
+    using T = typename OperandTraits<E>::ValueType;
+    return MakeElementwise(std::divides<>(), expr, ScalarOperand<T>{scalar});
+}
+
+template<ArrayOperand E>
+constexpr auto operator-(const E& expr) {
+    return MakeElementwise(std::negate<>(), expr);
+}
+
+// Поэлементное a * b + c
+template<typename A, typename B, typename C> requires SameShape<A, B> && SameShape<A, C>
+constexpr auto Fma(const A& a, const B& b, const C& c) {
+    return MakeElementwise(FusedMultiplyAdd(), a, b, c);
+}
+
+// Составные присваивания - вычисление на месте, без временного массива
+template<typename T, std::size_t N, std::size_t Align, typename E>
+    requires SameShape<Array<T, N, Align>, E>
+constexpr Array<T, N, Align>& operator+=(Array<T, N, Align>& lhs, const E& rhs) {
+    ForEachIndex<N>([&lhs, &rhs](std::size_t i) { lhs[i] += rhs[i]; });
+    return lhs;
+}
+
+template<typename T, std::size_t N, std::size_t Align, typename E>
+    requires SameShape<Array<T, N, Align>, E>
+constexpr Array<T, N, Align>& operator-=(Array<T, N, Align>& lhs, const E& rhs) {
+    ForEachIndex<N>([&lhs, &rhs](std::size_t i) { lhs[i] -= rhs[i]; });
+    return lhs;
+}
+
+template<typename T, std::size_t N, std::size_t Align, typename E>
+    requires SameShape<Array<T, N, Align>, E>
+constexpr Array<T, N, Align>& operator*=(Array<T, N, Align>& lhs, const E& rhs) {
+    ForEachIndex<N>([&lhs, &rhs](std::size_t i) { lhs[i] *= rhs[i]; });
+    return lhs;
+}
+
+template<typename T, std::size_t N, std::size_t Align, typename E>
+    requires SameShape<Array<T, N, Align>, E>
+constexpr Array<T, N, Align>& operator/=(Array<T, N, Align>& lhs, const E& rhs) {
+    ForEachIndex<N>([&lhs, &rhs](std::size_t i) { lhs[i] /= rhs[i]; });
+    return lhs;
+}
+
+// Свертки
+
+// Сумма элементов
+template<ArrayOperand E>
+constexpr auto Sum(const E& expr) {
+    using T = typename OperandTraits<E>::ValueType;
+    T sum{};
+    ForEachIndex<OperandTraits<E>::kSize>([&sum, &expr](std::size_t i) { sum += expr[i]; });
+    return sum;
+}
+
+// Скалярное произведение
+template<typename L, typename R> requires SameShape<L, R>
+constexpr auto Dot(const L& lhs, const R& rhs) {
+    return Sum(lhs * rhs);
+}
+
+// Минимальный элемент (для непустых массивов)
+template<ArrayOperand E> requires (OperandTraits<E>::kSize > 0)
+constexpr auto Min(const E& expr) {
+    auto result = expr[0];
+    ForEachIndex<OperandTraits<E>::kSize>([&result, &expr](std::size_t i) {
+        result = std::min(result, static_cast<decltype(result)>(expr[i]));
+    });
+    return result;
+}
+
+// Максимальный элемент (для непустых массивов)
+template<ArrayOperand E> requires (OperandTraits<E>::kSize > 0)
+constexpr auto Max(const E& expr) {
+    auto result = expr[0];
+    ForEachIndex<OperandTraits<E>::kSize>([&result, &expr](std::size_t i) {
+        result = std::max(result, static_cast<decltype(result)>(expr[i]));
+    });
+    return result;
+}
+
+// Матрица R x C фиксированного размера. Элементы хранятся построчно
+// в Array<T, R * C>, размеры проверяются на этапе компиляции: умножить
+// можно только Matrix<T, R, K> на Matrix<T, K, C>
+template<typename T, std::size_t R, std::size_t C>
+class Matrix {
+private:
+    Array<T, R * C> data_;
+
+public:
+    // Конструкторы
+    constexpr Matrix();
+    constexpr Matrix(std::initializer_list<T> init);  // по строкам
+
+    static constexpr Matrix Identity() requires (R == C);
+
+    // Доступ к элементам
+    constexpr T& operator()(std::size_t row, std::size_t col);
+    constexpr const T& operator()(std::size_t row, std::size_t col) const;
+
+    constexpr T* Data();
+    constexpr const T* Data() const;
+
+    static constexpr std::size_t Rows();
+    static constexpr std::size_t Cols();
+
+    constexpr Matrix<T, C, R> Transpose() const;
+
+    constexpr bool operator==(const Matrix& other) const;
+};
+
+// Конструктор по умолчанию - нулевая матрица
+template<typename T, std::size_t R, std::size_t C>
+constexpr Matrix<T, R, C>::Matrix() : data_{} {}
+
+// Конструктор от элементов по строкам, недостающие - нули
+template<typename T, std::size_t R, std::size_t C>
+constexpr Matrix<T, R, C>::Matrix(std::initializer_list<T> init) : data_(init) {}
+
+// Единичная матрица
+template<typename T, std::size_t R, std::size_t C>
+constexpr Matrix<T, R, C> Matrix<T, R, C>::Identity() requires (R == C) {
+    Matrix identity;
+    for (std::size_t i = 0; i < R; ++i) {
+        identity(i, i) = T{1};
+    }
+    return identity;
+}
+
+template<typename T, std::size_t R, std::size_t C>
+constexpr T& Matrix<T, R, C>::operator()(std::size_t row, std::size_t col) {
+    return data_[row * C + col];
+}
+
+template<typename T, std::size_t R, std::size_t C>
+constexpr const T& Matrix<T, R, C>::operator()(std::size_t row, std::size_t col) const {
+    return data_[row * C + col];
+}
+
+template<typename T, std::size_t R, std::size_t C>
+constexpr T* Matrix<T, R, C>::Data() {
+    return data_.Data();
+}
+
+template<typename T, std::size_t R, std::size_t C>
+constexpr const T* Matrix<T, R, C>::Data() const {
+    return data_.Data();
+}
+
+template<typename T, std::size_t R, std::size_t C>
+constexpr std::size_t Matrix<T, R, C>::Rows() {
+    return R;
+}
+
+template<typename T, std::size_t R, std::size_t C>
+constexpr std::size_t Matrix<T, R, C>::Cols() {
+    return C;
+}
+
+// Транспонирование
+template<typename T, std::size_t R, std::size_t C>
+constexpr Matrix<T, C, R> Matrix<T, R, C>::Transpose() const {
+    Matrix<T, C, R> result;
+    for (std::size_t i = 0; i < R; ++i) {
+        for (std::size_t j = 0; j < C; ++j) {
+            result(j, i) = (*this)(i, j);
+        }
+    }
+    return result;
+}
+
+template<typename T, std::size_t R, std::size_t C>
+constexpr bool Matrix<T, R, C>::operator==(const Matrix& other) const {
+    return data_ == other.data_;
+}
+
+// Умножение матриц. Строка результата накапливается в регистрах:
+// для каждого k к ней прибавляется строка k матрицы rhs, умноженная на
+// lhs(i, k). Внутренний цикл идет по непрерывной памяти без зависимостей
+// между итерациями и для малых C раскрывается, что позволяет компилятору
+// держать всю строку в векторных регистрах
+template<typename T, std::size_t R, std::size_t K, std::size_t C>
+constexpr Matrix<T, R, C> operator*(const Matrix<T, R, K>& lhs, const Matrix<T, K, C>& rhs) {
+    Matrix<T, R, C> result;
+    for (std::size_t i = 0; i < R; ++i) {
+        Array<T, C> row = {};
+        for (std::size_t k = 0; k < K; ++k) {
+            const T scale = lhs(i, k);
+            const T* rhs_row = rhs.Data() + k * C;
+            ForEachIndex<C>([&row, scale, rhs_row](std::size_t j) {
+                row[j] += scale * rhs_row[j];
+            });
+        }
+        std::copy(row.begin(), row.end(), result.Data() + i * C);
+    }
+    return result;
+}
+
+// Пакетное умножение: out[i] = lhs[i] * rhs[i]
+template<typename T, std::size_t R, std::size_t K, std::size_t C>
+void BatchedMultiply(std::span<const Matrix<T, R, K>> lhs,
+                     std::span<const Matrix<T, K, C>> rhs,
+                     std::span<Matrix<T, R, C>> out) {
+    if (lhs.size() != rhs.size() || lhs.size() != out.size()) {
+        throw std::invalid_argument("Batch sizes differ");
+    }
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        out[i] = lhs[i] * rhs[i];
+    }
+}
+
+// Пакетное умножение для непрерывных контейнеров матриц (std::vector, Array,
+// std::span): размеры матриц выводятся из типа элементов
+template<std::ranges::contiguous_range L, std::ranges::contiguous_range Rhs, std::ranges::contiguous_range O>
+    requires std::ranges::sized_range<L> && std::ranges::sized_range<Rhs> && std::ranges::sized_range<O>
+void BatchedMultiply(const L& lhs, const Rhs& rhs, O&& out) {
+    BatchedMultiply(std::span(std::ranges::data(lhs), std::ranges::size(lhs)),
+                    std::span(std::ranges::data(rhs), std::ranges::size(rhs)),
+                    std::span(std::ranges::data(out), std::ranges::size(out)));
+}
@@ -0,0 +1,195 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "array.cpp"
+
+// Время выполнения body в наносекундах на одну из operations операций
+template<typename Body>
+double NanosecondsPerOperation(size_t operations, Body body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(finish - start).count() / static_cast<double>(operations);
+}
+
+// Ядра вынесены в отдельные функции без встраивания, чтобы их код можно
+// было посмотреть: objdump -d --no-show-raw-insn benchmark_array | c++filt
+using Floats = Array<float, 16>;
+using AlignedFloats = Array<float, 16, 32>;
+
+// Копирование массива целиком: для тривиального T - memcpy
+__attribute__((noinline)) void CopyArray(const Floats& source, Floats& target) {
+    target = source;
+}
+
+__attribute__((noinline)) void CopyAlignedArray(const AlignedFloats& source, AlignedFloats& target) {
+    target = source;
+}
+
+// То же копирование поэлементным циклом, как было до constexpr-версии
+__attribute__((noinline)) void CopyLoop(const Floats& source, Floats& target) {
+    for (std::size_t i = 0; i < source.Size(); ++i) {
+        target[i] = source[i];
+    }
+}
+
+__attribute__((noinline)) void FillArray(Floats& target, float value) {
+    target.Fill(value);
+}
+
+// Копирование и заполнение count массивов по 16 float
+void BenchmarkCopy(size_t count, size_t repeats) {
+    std::printf("Array<float, 16>: ns per array\n");
+
+    std::vector<Floats> source(count), target(count);
+    std::vector<AlignedFloats> aligned_source(count), aligned_target(count);
+    for (size_t i = 0; i < count; ++i) {
+        source[i].Fill(static_cast<float>(i));
+        aligned_source[i].Fill(static_cast<float>(i));
+    }
+
+    auto run = [&](const char* name, auto body) {
+        double ns = NanosecondsPerOperation(count * repeats, [&] {
+            for (size_t r = 0; r < repeats; ++r) {
+                for (size_t i = 0; i < count; ++i) {
+                    body(i);
+                }
+            }
+        });
+        std::printf("%16s %8.2f\n", name, ns);
+    };
+
+    run("copy", [&](size_t i) { CopyArray(source[i], target[i]); });
+    run("copy aligned 32", [&](size_t i) { CopyAlignedArray(aligned_source[i], aligned_target[i]); });
+    run("copy loop", [&](size_t i) { CopyLoop(source[i], target[i]); });
+    run("fill", [&](size_t i) { FillArray(target[i], 1.0f); });
+}
+
+using Doubles = Array<double, 8>;
+
+// Выражение a * b + c одним проходом без временных массивов
+__attribute__((noinline)) void MultiplyAddExpression(const Doubles& a, const Doubles& b,
+                                                     const Doubles& c, Doubles& out) {
+    out = a * b + c;
+}
+
+__attribute__((noinline)) void MultiplyAddLoop(const Doubles& a, const Doubles& b,
+                                               const Doubles& c, Doubles& out) {
+    for (std::size_t i = 0; i < a.Size(); ++i) {
+        out[i] = a[i] * b[i] + c[i];
+    }
+}
+
+__attribute__((noinline)) double DotExpression(const Doubles& a, const Doubles& b) {
+    return Dot(a, b);
+}
+
+__attribute__((noinline)) double DotLoop(const Doubles& a, const Doubles& b) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < a.Size(); ++i) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+// Поэлементные выражения и свертки против рукописных циклов на Array<double, 8>
+void BenchmarkExpressions(size_t count, size_t repeats) {
+    std::printf("\nArray<double, 8>: ns per array\n");
+
+    std::vector<Doubles> a(count), b(count), c(count), out(count);
+    for (size_t i = 0; i < count; ++i) {
+        a[i].Fill(1.0 + static_cast<double>(i));
+        b[i].Fill(0.5);
+        c[i].Fill(2.0);
+    }
+
+    double total = 0.0;
+    auto run = [&](const char* name, auto body) {
+        double ns = NanosecondsPerOperation(count * repeats, [&] {
+            for (size_t r = 0; r < repeats; ++r) {
+                for (size_t i = 0; i < count; ++i) {
+                    body(i);
+                }
+            }
+        });
+        std::printf("%16s %8.2f\n", name, ns);
+    };
+
+    run("a*b+c expr", [&](size_t i) { MultiplyAddExpression(a[i], b[i], c[i], out[i]); });
+    run("a*b+c loop", [&](size_t i) { MultiplyAddLoop(a[i], b[i], c[i], out[i]); });
+    run("dot expr", [&](size_t i) { total += DotExpression(a[i], b[i]); });
+    run("dot loop", [&](size_t i) { total += DotLoop(a[i], b[i]); });
+    asm volatile("" : : "r"(&total) : "memory");
+}
+
+// Наивное умножение тройным циклом: скалярное произведение строки на столбец
+template<typename T, std::size_t R, std::size_t K, std::size_t C>
+__attribute__((noinline)) void NaiveBatchedMultiply(const std::vector<Matrix<T, R, K>>& lhs,
+                                                    const std::vector<Matrix<T, K, C>>& rhs,
+                                                    std::vector<Matrix<T, R, C>>& out) {
+    for (std::size_t b = 0; b < lhs.size(); ++b) {
+        for (std::size_t i = 0; i < R; ++i) {
+            for (std::size_t j = 0; j < C; ++j) {
+                T sum{};
+                for (std::size_t k = 0; k < K; ++k) {
+                    sum += lhs[b](i, k) * rhs[b](k, j);
+                }
+                out[b](i, j) = sum;
+            }
+        }
+    }
+}
+
+template<typename T, std::size_t N>
+__attribute__((noinline)) void KernelBatchedMultiply(const std::vector<Matrix<T, N, N>>& lhs,
+                                                     const std::vector<Matrix<T, N, N>>& rhs,
+                                                     std::vector<Matrix<T, N, N>>& out) {
+    BatchedMultiply(lhs, rhs, out);
+}
+
+// Пропускная способность пакетного умножения N x N: ядро с накоплением
+// строки в регистрах против тройного цикла
+template<typename T, std::size_t N>
+void BenchmarkMatrix(const char* type, size_t count, size_t repeats) {
+    std::vector<Matrix<T, N, N>> lhs(count), rhs(count), out(count);
+    for (size_t b = 0; b < count; ++b) {
+        for (std::size_t i = 0; i < N; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                lhs[b](i, j) = static_cast<T>(i + j + b % 7);
+                rhs[b](i, j) = static_cast<T>(i == j ? 1 : 0);
+            }
+        }
+    }
+
+    auto run = [&](auto multiply) {
+        return NanosecondsPerOperation(count * repeats, [&] {
+            for (size_t r = 0; r < repeats; ++r) {
+                multiply(lhs, rhs, out);
+                asm volatile("" : : "r"(out.data()) : "memory");
+            }
+        });
+    };
+    double kernel_ns = run(KernelBatchedMultiply<T, N>);
+    double naive_ns = run(NaiveBatchedMultiply<T, N, N, N>);
+    const double flops = 2.0 * N * N * N;
+    std::printf("%8s %3zux%-3zu %10.2f %10.2f %10.2f %10.2f\n", type, N, N,
+                kernel_ns, naive_ns, flops / kernel_ns, flops / naive_ns);
+}
+
+// Аргумент - число массивов (по умолчанию помещаются в L2)
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4096;
+
+    BenchmarkCopy(count, 2000);
+    BenchmarkExpressions(count, 2000);
+
+    std::printf("\nBatchedMultiply: ns per product and GFLOP/s\n");
+    std::printf("%8s %7s %10s %10s %10s %10s\n", "type", "size", "kernel", "naive", "kernel", "naive");
+    BenchmarkMatrix<float, 4>("float", count, 200);
+    BenchmarkMatrix<double, 4>("double", count, 200);
+    BenchmarkMatrix<float, 8>("float", count, 50);
+    BenchmarkMatrix<double, 8>("double", count, 50);
+    return 0;
+}
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include <utility>
+
+#include "array.cpp"
+#include "../../../05_week/tasks/tracer/tracer.cpp"
+
+// Аудит копирований Array<Tracer, 4> через CopyAudit: каждая операция
+// записывается в отчет, бюджет копий и перемещений проверяется по отчету
+TEST(ArrayCopyAuditTest, HotOperations) {
+    Tracer::ResetStats();
+    CopyAudit audit;
+    Array<Tracer, 4> source;
+    Array<Tracer, 4> target;
+
+    audit.Run("Array copy ctor", [&source] {
+        Array<Tracer, 4> copy(source);
+    });
+    audit.Run("Array move ctor", [&source] {
+        Array<Tracer, 4> moved(std::move(source));
+    });
+    audit.Run("Array move assign", [&source, &target] {
+        target = std::move(source);
+    });
+    audit.Run("Array swap", [&source, &target] {
+        source.Swap(target);
+    });
+    audit.Run("Array fill", [&target] {
+        target.Fill(Tracer("fill"));
+    });
+    audit.Run("Array get&&", [&target] {
+        Tracer item = get<0>(std::move(target));
+    });
+
+    // Копии только там, где они нужны по смыслу: копирующий конструктор
+    // и Fill. Обмен элемента через std::swap - одно перемещающее создание
+    // и два перемещающих присваивания
+    EXPECT_EQ(audit.Table(),
+              "operation            ctor    copy    move   copy=   move=    dtor\n"
+              "Array copy ctor         0       4       0       0       0       4\n"
+              "Array move ctor         0       0       4       0       0       4\n"
+              "Array move assign       0       0       0       0       4       0\n"
+              "Array swap              0       0       4       0       8       4\n"
+              "Array fill              1       0       0       4       0       1\n"
+              "Array get&&             0       0       1       0       0       1\n");
+    EXPECT_EQ(audit.Json(),
+              "[{\"operation\":\"Array copy ctor\",\"default_ctor\":0,\"str_ctor\":0,\"copy_ctor\":4,\"move_ctor\":0,\"copy_assign\":0,\"move_assign\":0,\"dtor\":4},"
+              "{\"operation\":\"Array move ctor\",\"default_ctor\":0,\"str_ctor\":0,\"copy_ctor\":0,\"move_ctor\":4,\"copy_assign\":0,\"move_assign\":0,\"dtor\":4},"
+              "{\"operation\":\"Array move assign\",\"default_ctor\":0,\"str_ctor\":0,\"copy_ctor\":0,\"move_ctor\":0,\"copy_assign\":0,\"move_assign\":4,\"dtor\":0},"
+              "{\"operation\":\"Array swap\",\"default_ctor\":0,\"str_ctor\":0,\"copy_ctor\":0,\"move_ctor\":4,\"copy_assign\":0,\"move_assign\":8,\"dtor\":4},"
+              "{\"operation\":\"Array fill\",\"default_ctor\":0,\"str_ctor\":1,\"copy_ctor\":0,\"move_ctor\":0,\"copy_assign\":4,\"move_assign\":0,\"dtor\":1},"
+              "{\"operation\":\"Array get&&\",\"default_ctor\":0,\"str_ctor\":0,\"copy_ctor\":0,\"move_ctor\":1,\"copy_assign\":0,\"move_assign\":0,\"dtor\":1}]");
+}
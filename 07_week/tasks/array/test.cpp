@@ -8,6 +8,9 @@
 #include <algorithm>
 #include <numeric>
 #include <type_traits>
+#include <cstdint>
+#include <cmath>
+#include <vector>
 
 
 class TestObject {
@@ -459,4 +462,320 @@ TEST(ArrayTest, SizeTest) {
         "Array should not have any additional fields");
     static_assert(sizeof(Array<double, 5>) == sizeof(double) * 5,
         "Array should not have any additional fields");
-}
\ No newline at end of file
+}
+
+// Массив целиком работает в константных выражениях
+constexpr Array<int, 4> MakeReversed() {
+    Array<int, 4> arr = {1, 2, 3, 4};
+    Array<int, 4> other;
+    other.Fill(0);
+    other.Swap(arr);
+    for (std::size_t i = 0; i < arr.Size(); ++i) {
+        arr[i] = other[other.Size() - 1 - i];
+    }
+    return arr;
+}
+
+TEST(ArrayTest, Constexpr) {
+    constexpr Array<int, 4> reversed = MakeReversed();
+    static_assert(reversed[0] == 4 && get<3>(reversed) == 1);
+    static_assert(reversed.Front() == 4 && reversed.Back() == 1);
+    static_assert(reversed > Array<int, 4>{3, 9, 9, 9});
+
+    constexpr Array<int, 3> partial = {7};
+    static_assert(partial[0] == 7 && partial[1] == 0 && partial[2] == 0);
+    EXPECT_EQ(reversed[1], 3);
+}
+
+TEST(ArrayTest, TriviallyCopyableForTrivialTypes) {
+    static_assert(std::is_trivially_copyable_v<Array<int, 8>>);
+    static_assert(std::is_trivially_copyable_v<Array<double, 3, 32>>);
+    static_assert(!std::is_trivially_copyable_v<Array<std::string, 2>>);
+    static_assert(std::is_nothrow_move_constructible_v<Array<std::string, 2>>);
+
+    // Value-инициализация обнуляет элементы
+    Array<int, 5> zeros = {};
+    for (int value : zeros) {
+        EXPECT_EQ(value, 0);
+    }
+}
+
+TEST(ArrayTest, Alignment) {
+    static_assert(alignof(Array<float, 16>) == alignof(float));
+    static_assert(alignof(Array<float, 16, 32>) == 32);
+    static_assert(sizeof(Array<float, 16, 32>) == 16 * sizeof(float));
+
+    Array<float, 8, 32> lanes = {1.0f, 2.0f};
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(lanes.Data()) % 32, 0);
+    EXPECT_EQ(lanes[1], 2.0f);
+}
+
+TEST(ArrayArithmeticTest, ElementwiseOperators) {
+    Array<double, 4> a = {1.0, 2.0, 3.0, 4.0};
+    Array<double, 4> b = {2.0, 2.0, 2.0, 2.0};
+    Array<double, 4> c = {0.5, 0.5, 0.5, 0.5};
+
+    Array<double, 4> result = a * b + c;
+    EXPECT_EQ(result, (Array<double, 4>{2.5, 4.5, 6.5, 8.5}));
+
+    result = (a - b) / b;
+    EXPECT_EQ(result, (Array<double, 4>{-0.5, 0.0, 0.5, 1.0}));
+
+    result = -a * 2.0 + 3.0 * c;
+    EXPECT_EQ(result, (Array<double, 4>{-0.5, -2.5, -4.5, -6.5}));
+
+    // Выражение вычисляется в массив с другим выравниванием
+    Array<double, 4, 32> aligned = a + a;
+    EXPECT_EQ(aligned[3], 8.0);
+}
+
+TEST(ArrayArithmeticTest, CompoundAssignment) {
+    Array<int, 3> a = {1, 2, 3};
+    Array<int, 3> b = {10, 20, 30};
+    a += b * b;
+    EXPECT_EQ(a, (Array<int, 3>{101, 402, 903}));
+    a -= b;
+    a /= b;
+    EXPECT_EQ(a, (Array<int, 3>{9, 19, 29}));
+    a *= a;
+    EXPECT_EQ(a, (Array<int, 3>{81, 361, 841}));
+}
+
+TEST(ArrayArithmeticTest, Reductions) {
+    Array<double, 3> a = {1.0, -2.0, 3.0};
+    Array<double, 3> b = {4.0, 5.0, 6.0};
+    EXPECT_DOUBLE_EQ(Sum(a), 2.0);
+    EXPECT_DOUBLE_EQ(Dot(a, b), 12.0);
+    EXPECT_DOUBLE_EQ(Min(a), -2.0);
+    EXPECT_DOUBLE_EQ(Max(a * b), 18.0);
+
+    // Большие N вычисляются циклом
+    Array<int, 100> ones;
+    ones.Fill(1);
+    EXPECT_EQ(Sum(ones + ones), 200);
+}
+
+TEST(ArrayArithmeticTest, FusedMultiplyAdd) {
+    Array<double, 2> a = {1.0 + 1e-8, 3.0};
+    Array<double, 2> b = {1.0 - 1e-8, 0.5};
+    Array<double, 2> c = {-1.0, 1.0};
+    Array<double, 2> fused = Fma(a, b, c);
+    EXPECT_DOUBLE_EQ(fused[1], 2.5);
+    // fma не округляет произведение: остается -1e-16
+    EXPECT_DOUBLE_EQ(fused[0], std::fma(a[0], b[0], c[0]));
+    EXPECT_LT(fused[0], 0.0);
+}
+
+constexpr double ConstexprDot() {
+    Array<double, 3> a = {1.0, 2.0, 3.0};
+    Array<double, 3> b = a * 2.0;
+    Array<double, 3> c = Fma(a, b, a);
+    return Dot(a, b) + Sum(c);
+}
+
+TEST(ArrayArithmeticTest, Constexpr) {
+    static_assert(ConstexprDot() == 28.0 + 34.0);
+    // Выражение не создает промежуточных массивов - это легкий узел
+    Array<double, 8> a;
+    a.Fill(1.0);
+    auto expr = a * a + a;
+    static_assert(!std::is_same_v<decltype(expr), Array<double, 8>>);
+    EXPECT_LT(sizeof(expr), sizeof(Array<double, 8>));
+}
+
+template<typename L, typename R>
+concept Multipliable = requires(const L& lhs, const R& rhs) { lhs * rhs; };
+
+TEST(MatrixTest, MultiplyAndTranspose) {
+    Matrix<int, 2, 3> a = {1, 2, 3,
+                           4, 5, 6};
+    Matrix<int, 3, 2> b = {7, 8,
+                           9, 10,
+                           11, 12};
+    Matrix<int, 2, 2> product = a * b;
+    EXPECT_EQ(product, (Matrix<int, 2, 2>{58, 64, 139, 154}));
+
+    Matrix<int, 3, 2> at = a.Transpose();
+    EXPECT_EQ(at(2, 1), 6);
+    EXPECT_EQ(at.Transpose(), a);
+    // (A * B)^T = B^T * A^T
+    EXPECT_EQ(product.Transpose(), b.Transpose() * a.Transpose());
+
+    // Несогласованные размеры не компилируются
+    static_assert(!Multipliable<Matrix<int, 2, 3>, Matrix<int, 2, 3>>);
+    static_assert(Multipliable<Matrix<int, 2, 3>, Matrix<int, 3, 5>>);
+    static_assert(Matrix<int, 2, 3>::Rows() == 2 && Matrix<int, 2, 3>::Cols() == 3);
+}
+
+TEST(MatrixTest, MatchesNaiveMultiply) {
+    Matrix<double, 8, 8> a;
+    Matrix<double, 8, 8> b;
+    for (std::size_t i = 0; i < 8; ++i) {
+        for (std::size_t j = 0; j < 8; ++j) {
+            a(i, j) = static_cast<double>(i * 8 + j) / 7.0;
+            b(i, j) = static_cast<double>(j) - static_cast<double>(i) * 0.5;
+        }
+    }
+    Matrix<double, 8, 8> product = a * b;
+    for (std::size_t i = 0; i < 8; ++i) {
+        for (std::size_t j = 0; j < 8; ++j) {
+            double expected = 0.0;
+            for (std::size_t k = 0; k < 8; ++k) {
+                expected += a(i, k) * b(k, j);
+            }
+            EXPECT_NEAR(product(i, j), expected, 1e-9);
+        }
+    }
+    EXPECT_EQ((a * Matrix<double, 8, 8>::Identity()), a);
+}
+
+TEST(MatrixTest, Constexpr) {
+    constexpr Matrix<int, 2, 2> rotation = {0, -1, 1, 0};
+    constexpr Matrix<int, 2, 2> full_turn = rotation * rotation * rotation * rotation;
+    static_assert(full_turn == Matrix<int, 2, 2>::Identity());
+    static_assert(std::is_trivially_copyable_v<Matrix<float, 4, 4>>);
+    EXPECT_EQ(full_turn(0, 0), 1);
+}
+
+TEST(MatrixTest, BatchedMultiply) {
+    std::vector<Matrix<int, 2, 2>> lhs = {{1, 2, 3, 4}, {2, 0, 0, 2}};
+    std::vector<Matrix<int, 2, 2>> rhs = {Matrix<int, 2, 2>::Identity(), {1, 1, 1, 1}};
+    std::vector<Matrix<int, 2, 2>> out(2);
+    BatchedMultiply<int, 2, 2, 2>(lhs, rhs, out);
+    EXPECT_EQ(out[0], lhs[0]);
+    EXPECT_EQ(out[1], (Matrix<int, 2, 2>{2, 2, 2, 2}));
+
+    std::vector<Matrix<int, 2, 2>> short_out(1);
+    EXPECT_THROW((BatchedMultiply<int, 2, 2, 2>(lhs, rhs, short_out)), std::invalid_argument);
+}
+
+TEST(MatrixTest, BatchedMultiplyDeducesSizes) {
+    std::vector<Matrix<double, 2, 3>> lhs = {{1, 2, 3, 4, 5, 6}};
+    std::vector<Matrix<double, 3, 1>> rhs = {{1, 1, 1}};
+    std::vector<Matrix<double, 2, 1>> out(1);
+    BatchedMultiply(lhs, rhs, out);
+    EXPECT_EQ(out[0], (Matrix<double, 2, 1>{6, 15}));
+
+    Array<Matrix<int, 2, 2>, 2> array_lhs = {Matrix<int, 2, 2>::Identity(), {1, 2, 3, 4}};
+    Array<Matrix<int, 2, 2>, 2> array_out;
+    BatchedMultiply(array_lhs, array_lhs, array_out);
+    EXPECT_EQ(array_out[1], (Matrix<int, 2, 2>{7, 10, 15, 22}));
+
+    std::span<const Matrix<int, 2, 2>> span_lhs(array_lhs.Data(), 2);
+    BatchedMultiply(span_lhs, span_lhs, std::span(array_out.Data(), 2));
+    EXPECT_EQ(array_out[0], (Matrix<int, 2, 2>::Identity()));
+
+    std::vector<Matrix<double, 2, 1>> short_out;
+    EXPECT_THROW(BatchedMultiply(lhs, rhs, short_out), std::invalid_argument);
+}
+
+// Элемент для аудита копирований: каждый объект помнит, сколько копирований
+// и присваиваний было в цепочке, которая его создала. Все операции constexpr,
+// поэтому бюджет копий проверяется еще при компиляции
+struct AuditElement {
+    int copies = 0;
+    int assignments = 0;
+
+    constexpr AuditElement() = default;
+    constexpr AuditElement(const AuditElement& other)
+        : copies(other.copies + 1), assignments(other.assignments) {}
+    constexpr AuditElement(AuditElement&& other) noexcept
+        : copies(other.copies), assignments(other.assignments) {}
+
+    constexpr AuditElement& operator=(const AuditElement& other) {
+        copies = other.copies + 1;
+        assignments = other.assignments + 1;
+        return *this;
+    }
+
+    constexpr AuditElement& operator=(AuditElement&& other) noexcept {
+        copies = other.copies;
+        assignments = other.assignments + 1;
+        return *this;
+    }
+};
+
+// Копии и присваивания, потребовавшиеся для получения элементов массива
+struct AuditCounts {
+    int copies = 0;
+    int assignments = 0;
+};
+
+template<std::size_t N>
+constexpr AuditCounts Audit(const Array<AuditElement, N>& array) {
+    AuditCounts counts;
+    for (const AuditElement& element : array) {
+        counts.copies += element.copies;
+        counts.assignments += element.assignments;
+    }
+    return counts;
+}
+
+constexpr AuditCounts AuditCopyCtor() {
+    Array<AuditElement, 4> source;
+    Array<AuditElement, 4> copy(source);
+    return Audit(copy);
+}
+
+constexpr AuditCounts AuditMoveCtor() {
+    Array<AuditElement, 4> source;
+    Array<AuditElement, 4> moved(std::move(source));
+    return Audit(moved);
+}
+
+constexpr AuditCounts AuditMoveAssign() {
+    Array<AuditElement, 4> source;
+    Array<AuditElement, 4> other;
+    other = std::move(source);
+    return Audit(other);
+}
+
+constexpr AuditCounts AuditSwap() {
+    Array<AuditElement, 4> source;
+    Array<AuditElement, 4> other;
+    source.Swap(other);
+    AuditCounts lhs = Audit(source);
+    AuditCounts rhs = Audit(other);
+    return {lhs.copies + rhs.copies, lhs.assignments + rhs.assignments};
+}
+
+constexpr AuditCounts AuditFill() {
+    Array<AuditElement, 4> source;
+    source.Fill(AuditElement());
+    return Audit(source);
+}
+
+constexpr AuditCounts AuditGetRvalue() {
+    Array<AuditElement, 4> source;
+    AuditElement taken = get<0>(std::move(source));
+    return {taken.copies, taken.assignments};
+}
+
+// Бюджет копий горячих операций: лишняя копия ломает сборку
+static_assert(AuditCopyCtor().copies == 4 && AuditCopyCtor().assignments == 0,
+              "copy ctor must copy-construct elements, not default-construct and assign");
+static_assert(AuditMoveCtor().copies == 0 && AuditMoveCtor().assignments == 0, "move ctor must not copy");
+static_assert(AuditMoveAssign().copies == 0 && AuditMoveAssign().assignments == 4,
+              "move assignment must move-assign each element once");
+static_assert(AuditSwap().copies == 0 && AuditSwap().assignments == 8,
+              "swap must not copy: std::swap of an element does two move assignments");
+static_assert(AuditFill().copies == 4 && AuditFill().assignments == 4,
+              "fill must copy-assign the value once per element");
+static_assert(AuditGetRvalue().copies == 0 && AuditGetRvalue().assignments == 0,
+              "get on rvalue must move the element out");
+
+// Те же проверки во время выполнения, чтобы они были видны в отчете тестов
+TEST(ArrayAuditTest, HotOperationsDoNotCopy) {
+    EXPECT_EQ(AuditCopyCtor().copies, 4);
+    EXPECT_EQ(AuditCopyCtor().assignments, 0);
+    EXPECT_EQ(AuditMoveCtor().copies, 0);
+    EXPECT_EQ(AuditMoveCtor().assignments, 0);
+    EXPECT_EQ(AuditMoveAssign().copies, 0);
+    EXPECT_EQ(AuditMoveAssign().assignments, 4);
+    EXPECT_EQ(AuditSwap().copies, 0);
+    EXPECT_EQ(AuditSwap().assignments, 8);
+    EXPECT_EQ(AuditFill().copies, 4);
+    EXPECT_EQ(AuditFill().assignments, 4);
+    EXPECT_EQ(AuditGetRvalue().copies, 0);
+    EXPECT_EQ(AuditGetRvalue().assignments, 0);
+}
@@ -0,0 +1,80 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory_resource>
+#include <vector>
+
+#include "make_unique.cpp"
+
+// Время выполнения body в наносекундах на одну из operations операций
+template<typename Body>
+double NanosecondsPerOperation(size_t operations, Body body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(finish - start).count() / static_cast<double>(operations);
+}
+
+// Небольшой объект, какие обычно создаются тысячами за запрос
+struct Node {
+    int key;
+    double weight;
+    Node* next;
+
+    Node(int key, double weight) : key(key), weight(weight), next(nullptr) {}
+};
+
+// Создание и удаление count объектов: глобальная куча, монотонная арена
+// (освобождается целиком в конце) и пул с повторным использованием блоков
+void BenchmarkObjects(size_t count) {
+    std::printf("%zu objects: create+destroy, ns/object\n", count);
+
+    auto run = [count](const char* name, auto create) {
+        double ns = NanosecondsPerOperation(count, [&] {
+            std::vector<decltype(create(0))> nodes;
+            nodes.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                nodes.push_back(create(static_cast<int>(i)));
+            }
+            asm volatile("" : : "r"(nodes.data()) : "memory");
+        });
+        std::printf("%12s %10.2f\n", name, ns);
+    };
+
+    run("new", [](int i) { return MakeUnique<Node>(i, 1.0); });
+    {
+        std::pmr::monotonic_buffer_resource arena(count * sizeof(Node));
+        run("monotonic", [&arena](int i) { return MakeUniqueIn<Node>(arena, i, 1.0); });
+    }
+    {
+        std::pmr::unsynchronized_pool_resource pool;
+        run("pool", [&pool](int i) { return MakeUniqueIn<Node>(pool, i, 1.0); });
+    }
+}
+
+// Выделение буфера из size чисел с обнулением и без
+void BenchmarkBuffer(size_t size, size_t repeats) {
+    std::printf("\n%zu ints buffer, ns/allocation\n", size);
+
+    auto run = [repeats](const char* name, auto create) {
+        double ns = NanosecondsPerOperation(repeats, [&] {
+            for (size_t i = 0; i < repeats; ++i) {
+                auto buffer = create();
+                asm volatile("" : : "r"(buffer.get()) : "memory");
+            }
+        });
+        std::printf("%12s %10.2f\n", name, ns);
+    };
+
+    run("zeroed", [size] { return MakeUnique<int[]>(size); });
+    run("overwrite", [size] { return MakeUniqueForOverwrite<int[]>(size); });
+}
+
+// Аргумент - число объектов
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+
+    BenchmarkObjects(count);
+    BenchmarkBuffer(1 << 20, 200);
+    return 0;
+}
@@ -1,9 +1,121 @@
+#include <cstddef>
 #include <memory>
+#include <memory_resource>
+#include <type_traits>
 #include <utility>  // для std::forward
 
 // Создает unique_ptr на объект типа T, передавая аргументы в его конструктор
-template<typename T, typename... Args>
+template<typename T, typename... Args> requires (!std::is_array_v<T>)
 std::unique_ptr<T> MakeUnique(Args&&... args) {
     return std::unique_ptr<T>(new T(std::forward<Args>(args)...));
 }
 
+// Создает unique_ptr на массив из size элементов, инициализированных значением по умолчанию
+template<typename T> requires std::is_unbounded_array_v<T>
+std::unique_ptr<T> MakeUnique(std::size_t size) {
+    return std::unique_ptr<T>(new std::remove_extent_t<T>[size]());
+}
+
+// Создает unique_ptr на объект без обнуления (default-initialization):
+// для тривиальных типов содержимое не определено и будет перезаписано
+template<typename T> requires (!std::is_array_v<T>)
+std::unique_ptr<T> MakeUniqueForOverwrite() {
+    return std::unique_ptr<T>(new T);
+}
+
+// Создает unique_ptr на массив без прохода обнуления - для больших буферов,
+// которые сразу будут заполнены
+template<typename T> requires std::is_unbounded_array_v<T>
+std::unique_ptr<T> MakeUniqueForOverwrite(std::size_t size) {
+    return std::unique_ptr<T>(new std::remove_extent_t<T>[size]);
+}
+
+// Удалитель для объектов из арены: вызывает деструктор и возвращает память
+// той арене, из которой она была взята (у монотонной арены возврат бесплатный).
+// Размер и выравнивание запоминаются при создании объекта, поэтому указатель
+// на базовый класс возвращает арене блок настоящего размера
+template<typename T>
+class ArenaDelete {
+private:
+    std::pmr::memory_resource* arena_;
+    std::size_t size_;
+    std::size_t alignment_;
+
+public:
+    ArenaDelete();
+    explicit ArenaDelete(std::pmr::memory_resource* arena);
+    template<typename U> requires std::is_convertible_v<U*, T*>
+    ArenaDelete(const ArenaDelete<U>& other);
+
+    void operator()(T* ptr) const;
+    std::pmr::memory_resource* Arena() const;
+    std::size_t Size() const;
+    std::size_t Alignment() const;
+};
+
+// Конструктор по умолчанию - глобальная куча
+template<typename T>
+ArenaDelete<T>::ArenaDelete()
+    : arena_(std::pmr::new_delete_resource()), size_(sizeof(T)), alignment_(alignof(T)) {}
+
+// Конструктор от арены
+template<typename T>
+ArenaDelete<T>::ArenaDelete(std::pmr::memory_resource* arena)
+    : arena_(arena), size_(sizeof(T)), alignment_(alignof(T)) {}
+
+// Конструктор от удалителя для совместимого типа: размер и выравнивание
+// остаются от настоящего типа объекта
+template<typename T>
+template<typename U> requires std::is_convertible_v<U*, T*>
+ArenaDelete<T>::ArenaDelete(const ArenaDelete<U>& other)
+    : arena_(other.Arena()), size_(other.Size()), alignment_(other.Alignment()) {}
+
+// Уничтожить объект и вернуть память арене. У полиморфного объекта начало
+// блока берется через dynamic_cast<void*>: базовый класс может быть смещен
+// относительно начала объекта
+template<typename T>
+void ArenaDelete<T>::operator()(T* ptr) const {
+    void* memory = ptr;
+    if constexpr (std::is_polymorphic_v<T>) {
+        memory = dynamic_cast<void*>(ptr);
+    }
+    std::destroy_at(ptr);
+    arena_->deallocate(memory, size_, alignment_);
+}
+
+// Получить арену
+template<typename T>
+std::pmr::memory_resource* ArenaDelete<T>::Arena() const {
+    return arena_;
+}
+
+// Размер блока, выделенного под объект
+template<typename T>
+std::size_t ArenaDelete<T>::Size() const {
+    return size_;
+}
+
+// Выравнивание блока, выделенного под объект
+template<typename T>
+std::size_t ArenaDelete<T>::Alignment() const {
+    return alignment_;
+}
+
+// Указатель на объект в арене
+template<typename T>
+using ArenaUniquePtr = std::unique_ptr<T, ArenaDelete<T>>;
+
+// Создает объект типа T в арене (например, std::pmr::monotonic_buffer_resource
+// или std::pmr::unsynchronized_pool_resource) и возвращает владеющий указатель.
+// Арена должна жить дольше указателя
+template<typename T, typename... Args> requires (!std::is_array_v<T>)
+ArenaUniquePtr<T> MakeUniqueIn(std::pmr::memory_resource& arena, Args&&... args) {
+    void* memory = arena.allocate(sizeof(T), alignof(T));
+    try {
+        T* ptr = ::new (memory) T(std::forward<Args>(args)...);
+        return ArenaUniquePtr<T>(ptr, ArenaDelete<T>(&arena));
+    } catch (...) {
+        arena.deallocate(memory, sizeof(T), alignof(T));
+        throw;
+    }
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 //#include <gmock/gmock.h>
+#include <memory_resource>
+#include <vector>
 
 #include "make_unique.cpp"
 
@@ -343,4 +345,133 @@ TEST(MakeUniqueTest, PerfectForwardingCopyVsMove) {
 
     EXPECT_EQ(CopyMoveTracker::getCopyCount(), 1);
     EXPECT_EQ(CopyMoveTracker::getMoveCount(), 1);
-}
\ No newline at end of file
+}
+
+TEST(MakeUniqueTest, ArrayValueInitialized) {
+    auto array = MakeUnique<int[]>(4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(array[i], 0);
+    }
+}
+
+TEST(MakeUniqueForOverwriteTest, ArrayCanBeFilled) {
+    constexpr std::size_t size = 1024;
+    auto buffer = MakeUniqueForOverwrite<int[]>(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        buffer[i] = static_cast<int>(i);
+    }
+    EXPECT_EQ(buffer[size - 1], static_cast<int>(size - 1));
+
+    auto object = MakeUniqueForOverwrite<TestObject>();
+    EXPECT_EQ(object->getName(), "default");
+}
+
+TEST(MakeUniqueInTest, MonotonicArena) {
+    alignas(std::max_align_t) std::byte storage[256];
+    std::pmr::monotonic_buffer_resource arena(storage, sizeof(storage),
+                                              std::pmr::null_memory_resource());
+    TestObject::reset();
+    {
+        auto ptr = MakeUniqueIn<TestObject>(arena, "arena", 7);
+        EXPECT_EQ(ptr->getName(), "arena");
+        EXPECT_EQ(ptr->getValue(), 7);
+        EXPECT_GE(reinterpret_cast<std::byte*>(ptr.get()), storage);
+        EXPECT_LT(reinterpret_cast<std::byte*>(ptr.get()), storage + sizeof(storage));
+        EXPECT_EQ(ptr.get_deleter().Arena(), &arena);
+    }
+    EXPECT_EQ(TestObject::param_ctor, 1);
+    EXPECT_EQ(TestObject::dtor_calls, 1);
+}
+
+TEST(MakeUniqueInTest, PoolArenaReusesMemory) {
+    std::pmr::unsynchronized_pool_resource pool;
+    void* first = nullptr;
+    {
+        auto ptr = MakeUniqueIn<int>(pool, 1);
+        first = ptr.get();
+    }
+    auto ptr = MakeUniqueIn<int>(pool, 2);
+    EXPECT_EQ(ptr.get(), first);
+    EXPECT_EQ(*ptr, 2);
+}
+
+TEST(MakeUniqueInTest, ExceptionReturnsMemory) {
+    std::pmr::unsynchronized_pool_resource pool;
+    ThrowOnConstruction::should_throw = true;
+    EXPECT_THROW(MakeUniqueIn<ThrowOnConstruction>(pool, 1), std::runtime_error);
+    ThrowOnConstruction::should_throw = false;
+
+    auto ptr = MakeUniqueIn<ThrowOnConstruction>(pool, 1);
+    EXPECT_TRUE(ptr);
+}
+
+// Ресурс, проверяющий, что блок возвращается с тем же размером и выравниванием
+class CheckedResource : public std::pmr::memory_resource {
+public:
+    std::size_t allocated = 0;
+    std::size_t mismatches = 0;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        void* ptr = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        blocks_.push_back({ptr, bytes, alignment});
+        allocated += bytes;
+        return ptr;
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override {
+        for (auto it = blocks_.begin(); it != blocks_.end(); ++it) {
+            if (it->ptr == ptr) {
+                mismatches += it->bytes != bytes || it->alignment != alignment;
+                bytes = it->bytes;
+                alignment = it->alignment;
+                blocks_.erase(it);
+                allocated -= bytes;
+                std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+                return;
+            }
+        }
+        ++mismatches;
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    struct Block {
+        void* ptr;
+        std::size_t bytes;
+        std::size_t alignment;
+    };
+    std::vector<Block> blocks_;
+};
+
+struct ArenaBase {
+    virtual ~ArenaBase() = default;
+    int base = 1;
+};
+
+struct ArenaMixin {
+    virtual ~ArenaMixin() = default;
+    long long mixin = 2;
+};
+
+struct alignas(32) ArenaDerived : ArenaBase, ArenaMixin {
+    std::byte payload[96] = {};
+};
+
+TEST(MakeUniqueInTest, BasePointerReturnsDerivedBlock) {
+    CheckedResource resource;
+    {
+        ArenaUniquePtr<ArenaBase> base = MakeUniqueIn<ArenaDerived>(resource);
+        EXPECT_EQ(base.get_deleter().Size(), sizeof(ArenaDerived));
+        EXPECT_EQ(base.get_deleter().Alignment(), alignof(ArenaDerived));
+    }
+    {
+        // Второй базовый класс смещен относительно начала объекта
+        ArenaUniquePtr<ArenaMixin> mixin = MakeUniqueIn<ArenaDerived>(resource);
+        EXPECT_EQ(mixin->mixin, 2);
+    }
+    EXPECT_EQ(resource.allocated, 0u);
+    EXPECT_EQ(resource.mismatches, 0u);
+}
@@ -21,9 +21,27 @@ function(add_gtest_asan TARGET)
     )
 endfunction()
 
+function(add_gtest_tsan TARGET)
+    add_psds_executable(${TARGET} ${ARGN})
+    target_compile_options(${TARGET} PRIVATE -g -fsanitize=thread)
+    target_link_libraries(${TARGET} PRIVATE GTest::gtest GTest::gtest_main)
+    target_link_options(${TARGET} PRIVATE -fsanitize=thread)
+    set_target_properties(${TARGET} PROPERTIES
+        RUNTIME_OUTPUT_DIRECTORY ${CMAKE_BINARY_TASKS_DIR}
+    )
+endfunction()
+
 function(add_example NAME)
     if(BUILD_EXAMPLES)
         add_psds_executable(${NAME} ${ARGN})
         set_target_properties(${NAME} PROPERTIES FOLDER "examples")
     endif()
-endfunction()
\ No newline at end of file
+endfunction()
+
+function(add_benchmark TARGET)
+    add_psds_executable(${TARGET} ${ARGN})
+    target_compile_options(${TARGET} PRIVATE -O2)
+    set_target_properties(${TARGET} PROPERTIES
+        RUNTIME_OUTPUT_DIRECTORY ${CMAKE_BINARY_TASKS_DIR}
+    )
+endfunction()